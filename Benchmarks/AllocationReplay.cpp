@@ -0,0 +1,183 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "AllocationReplay.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+
+namespace ICMemoryBenchmark
+{
+    namespace
+    {
+        constexpr std::size_t k_minBuddyAllocatorSize = 1024 * 1024;
+        constexpr std::size_t k_buddyMinBlockSize = 64;
+        constexpr std::size_t k_minSmallObjectAllocatorSize = 64 * 1024;
+        constexpr std::size_t k_maxBlockSize = 4 * 1024;
+        constexpr std::size_t k_blockPageSize = 64 * 1024;
+        constexpr std::size_t k_defaultAlignment = alignof(std::max_align_t);
+
+        /// @param value
+        ///        The value to round up.
+        ///
+        /// @return The smallest power of two greater than or equal to the value.
+        ///
+        std::size_t RoundUpToPowerOfTwo(std::uint64_t value) noexcept
+        {
+            std::size_t powerOfTwo = 1;
+            while (powerOfTwo < value)
+            {
+                powerOfTwo <<= 1;
+            }
+
+            return powerOfTwo;
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t StandardAllocator::GetMaxAllocationSize() const noexcept
+    {
+        return static_cast<std::size_t>(-1);
+    }
+
+    //------------------------------------------------------------------------------
+    void* StandardAllocator::Allocate(std::size_t allocationSize) noexcept
+    {
+        return std::malloc(allocationSize);
+    }
+
+    //------------------------------------------------------------------------------
+    void StandardAllocator::Deallocate(void* pointer) noexcept
+    {
+        std::free(pointer);
+    }
+
+    //------------------------------------------------------------------------------
+    ReplayResult ReplayRecords(IC::BenchmarkContext& context_, IC::IAllocator& allocator, const IC::AllocationTraceRecord* records, std::uint64_t numRecords,
+        std::vector<ReplaySlot>& slots) noexcept
+    {
+        auto maxAllocationSize = allocator.GetMaxAllocationSize();
+        ReplayResult result;
+
+        for (std::uint64_t i = 0; i < numRecords; ++i)
+        {
+            const auto& record = records[i];
+            auto& slot = slots[record.m_slot];
+
+            if (record.m_event == static_cast<std::uint8_t>(IC::AllocationTraceEvent::k_allocate))
+            {
+                auto allocationSize = std::max(static_cast<std::size_t>(record.m_size), static_cast<std::size_t>(1));
+                auto alignment = static_cast<std::size_t>(1) << record.m_alignmentLog2;
+                if (alignment > k_defaultAlignment)
+                {
+                    allocationSize += alignment;
+                }
+
+                slot.m_pointer = allocationSize <= maxAllocationSize ? IC_TIMEALLOCATION(allocator.Allocate(allocationSize)) : nullptr;
+                slot.m_fallback = slot.m_pointer == nullptr;
+                if (slot.m_fallback)
+                {
+                    slot.m_pointer = std::malloc(allocationSize);
+                    ++result.m_numFallbacks;
+                }
+
+                IC::TouchMemory(slot.m_pointer, allocationSize);
+                result.m_numBytes += record.m_size;
+            }
+            else if (slot.m_pointer)
+            {
+                if (slot.m_fallback)
+                {
+                    std::free(slot.m_pointer);
+                }
+                else
+                {
+                    IC_TIMEDEALLOCATION(allocator.Deallocate(slot.m_pointer));
+                }
+
+                slot.m_pointer = nullptr;
+            }
+        }
+
+        return result;
+    }
+
+    //------------------------------------------------------------------------------
+    void FreeReplaySlots(IC::IAllocator& allocator, std::vector<ReplaySlot>& slots) noexcept
+    {
+        for (auto& slot : slots)
+        {
+            if (slot.m_pointer && slot.m_fallback)
+            {
+                std::free(slot.m_pointer);
+            }
+            else if (slot.m_pointer)
+            {
+                allocator.Deallocate(slot.m_pointer);
+            }
+
+            slot.m_pointer = nullptr;
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    void RegisterAllocatorBenchmarks(const std::string& benchmarkGroupName, const std::string& namePrefix, const ReplayRequirements& requirements,
+        const ReplayDelegate& replay) noexcept
+    {
+        auto& registry = IC::BenchmarkRegistry::Get();
+
+        registry.RegisterBenchmark(IC::Benchmark(benchmarkGroupName, namePrefix + "StandardAllocator", [=](IC::BenchmarkContext& context) noexcept
+        {
+            StandardAllocator allocator;
+            replay(context, allocator, ReplayAllocator::k_standard);
+        }));
+
+        auto buddyAllocatorSize = RoundUpToPowerOfTwo(std::max<std::uint64_t>({ k_minBuddyAllocatorSize, 4 * requirements.m_peakLiveBytes, 2 * requirements.m_maxAllocationSize }));
+        registry.RegisterBenchmark(IC::Benchmark(benchmarkGroupName, namePrefix + "BuddyAllocator", [=](IC::BenchmarkContext& context) noexcept
+        {
+            IC::BuddyAllocator allocator(buddyAllocatorSize, k_buddyMinBlockSize);
+            replay(context, allocator, ReplayAllocator::k_buddy);
+        }));
+
+        if (requirements.m_maxAllocationSize <= IC::SmallObjectAllocator(k_minSmallObjectAllocatorSize).GetMaxAllocationSize())
+        {
+            auto smallObjectAllocatorSize = static_cast<std::size_t>(std::max<std::uint64_t>(k_minSmallObjectAllocatorSize, 2 * requirements.m_peakLiveBytes));
+            registry.RegisterBenchmark(IC::Benchmark(benchmarkGroupName, namePrefix + "SmallObjectAllocator", [=](IC::BenchmarkContext& context) noexcept
+            {
+                IC::SmallObjectAllocator allocator(smallObjectAllocatorSize);
+                replay(context, allocator, ReplayAllocator::k_smallObject);
+            }));
+        }
+
+        if (requirements.m_maxAllocationSize <= k_maxBlockSize)
+        {
+            auto blockSize = std::max(k_defaultAlignment, (static_cast<std::size_t>(requirements.m_maxAllocationSize) + k_defaultAlignment - 1) / k_defaultAlignment * k_defaultAlignment);
+            auto numBlocksPerPage = k_blockPageSize / blockSize;
+            registry.RegisterBenchmark(IC::Benchmark(benchmarkGroupName, namePrefix + "PagedBlockAllocator", [=](IC::BenchmarkContext& context) noexcept
+            {
+                IC::PagedBlockAllocator allocator(blockSize, numBlocksPerPage);
+                replay(context, allocator, ReplayAllocator::k_pagedBlock);
+            }));
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,163 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICMEMORYBENCHMARK_ALLOCATIONREPLAY_H_
+#define _ICMEMORYBENCHMARK_ALLOCATIONREPLAY_H_
+
+#include "../ICBenchmark/ICBenchmark.h"
+#include "../ICMemory/ICMemory.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ICMemoryBenchmark
+{
+    /// An allocator which forwards to malloc() and free(), so that the standard
+    /// allocator can be replayed through the same code as the ICMemory
+    /// allocators.
+    ///
+    class StandardAllocator final : public IC::IAllocator
+    {
+    public:
+        std::size_t GetMaxAllocationSize() const noexcept override;
+
+        void* Allocate(std::size_t allocationSize) noexcept override;
+
+        void Deallocate(void* pointer) noexcept override;
+    };
+
+    /// An allocation made while replaying a sequence of allocation records.
+    ///
+    struct ReplaySlot final
+    {
+        void* m_pointer = nullptr;
+        bool m_fallback = false;
+    };
+
+    /// The outcome of replaying a sequence of allocation records.
+    ///
+    struct ReplayResult final
+    {
+        std::uint64_t m_numBytes = 0;
+        std::uint64_t m_numFallbacks = 0;
+    };
+
+    /// Describes the allocations made by a replay benchmark, so that each
+    /// allocator can be sized to serve them.
+    ///
+    struct ReplayRequirements final
+    {
+        std::uint64_t m_maxAllocationSize = 0;
+        std::uint64_t m_peakLiveBytes = 0;
+    };
+
+    /// The allocators which replay benchmarks are registered against.
+    ///
+    enum class ReplayAllocator
+    {
+        k_standard,
+        k_buddy,
+        k_smallObject,
+        k_pagedBlock
+    };
+
+    /// The function called to perform a replay benchmark against an allocator.
+    ///
+    /// @param context
+    ///        The context of the benchmark.
+    /// @param allocator
+    ///        The allocator to replay against.
+    /// @param allocatorType
+    ///        Which of the allocators the allocator is.
+    ///
+    using ReplayDelegate = std::function<void(IC::BenchmarkContext& context, IC::IAllocator& allocator, ReplayAllocator allocatorType) noexcept>;
+
+    /// Replays the given allocation records against an allocator, in order and
+    /// on the calling thread, without touching the timer. Each allocation is
+    /// touched, as in the other benchmarks.
+    ///
+    /// Allocations which are larger than the allocator supports, or which it
+    /// can't satisfy, fall back to malloc() so that the rest of the sequence
+    /// can still be replayed. Requested alignments larger than the default are
+    /// emulated by over-allocating.
+    ///
+    /// @param context_
+    ///        The context of the benchmark, used to record latencies.
+    /// @param allocator
+    ///        The allocator to replay against.
+    /// @param records
+    ///        The records to replay.
+    /// @param numRecords
+    ///        The number of records.
+    /// @param slots
+    ///        The live allocations, indexed by slot. This must have an element
+    ///        for every slot used by the records.
+    ///
+    /// @return The total number of bytes requested and the number of
+    /// allocations which fell back to malloc().
+    ///
+    ReplayResult ReplayRecords(IC::BenchmarkContext& context_, IC::IAllocator& allocator, const IC::AllocationTraceRecord* records, std::uint64_t numRecords,
+        std::vector<ReplaySlot>& slots) noexcept;
+
+    /// Frees every allocation which is still live after a replay.
+    ///
+    /// @param allocator
+    ///        The allocator the records were replayed against.
+    /// @param slots
+    ///        The live allocations, which are all cleared.
+    ///
+    void FreeReplaySlots(IC::IAllocator& allocator, std::vector<ReplaySlot>& slots) noexcept;
+
+    /// Registers one benchmark per allocator in the given group which can serve
+    /// the given requirements:
+    ///
+    ///  - The standard allocator, always.
+    ///  - A BuddyAllocator, always, sized to a power of two with room for the
+    ///    peak live bytes after rounding each allocation up to a power of two
+    ///    and for the largest allocation.
+    ///  - A SmallObjectAllocator, with a buffer twice the peak live bytes, if
+    ///    it supports the largest allocation.
+    ///  - A PagedBlockAllocator, with blocks the size of the largest allocation,
+    ///    if that is no larger than 4KB. Above that most of each block would
+    ///    be wasted.
+    ///
+    /// Each benchmark creates its allocator on every run and then calls the
+    /// given function. Allocations which still can't be served, for example
+    /// because of fragmentation, fall back to malloc() and should be reported.
+    ///
+    /// @param benchmarkGroupName
+    ///        The name of the group.
+    /// @param namePrefix
+    ///        The prefix of each benchmark's name, which is followed by the
+    ///        name of the allocator.
+    /// @param requirements
+    ///        The allocations the benchmark makes.
+    /// @param replay
+    ///        The function which performs the benchmark.
+    ///
+    void RegisterAllocatorBenchmarks(const std::string& benchmarkGroupName, const std::string& namePrefix, const ReplayRequirements& requirements,
+        const ReplayDelegate& replay) noexcept;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,193 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICBenchmark/ICBenchmark.h"
+#include "../ICMemory/ICMemory.h"
+#include "LinearAllocatorFixtures.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+
+namespace ICMemoryBenchmark
+{
+    namespace
+    {
+        constexpr std::uint64_t k_numAllocationsPerIteration = 4;
+        constexpr std::uint64_t k_minAllocationSize = 8;
+        constexpr std::uint64_t k_maxAllocationSize = 64 * 1024 * 1024;
+        constexpr std::uint64_t k_minBuddyBlockSize = 16;
+
+        constexpr std::size_t k_minLinearAllocatorSize = 1024 * 1024;
+
+        /// A fixture which owns a linear allocator of the given type, sized to fit
+        /// exactly the allocations made in a whole number of iterations and at
+        /// least k_minLinearAllocatorSize. The allocator is reset with the timer
+        /// paused once that many iterations have been performed, so the cost of
+        /// pausing the timer is spread over them.
+        ///
+        template <typename TAllocator> class LinearAllocatorFixture : public IC::BenchmarkFixture
+        {
+        public:
+            void SetUp(const IC::BenchmarkParameters& parameters) noexcept override
+            {
+                auto numBytesPerIteration = LinearAllocatorFixtures::GetAlignedSize(static_cast<std::size_t>(parameters.Get("size"))) * k_numAllocationsPerIteration;
+                auto numIterationsPerReset = std::max<std::size_t>(1, k_minLinearAllocatorSize / numBytesPerIteration);
+
+                SetIterationInterval(numIterationsPerReset);
+                m_allocator.reset(new TAllocator(numBytesPerIteration * numIterationsPerReset));
+            }
+
+            void TearDown() noexcept override
+            {
+                m_allocator.reset();
+            }
+
+            void TearDownIteration() noexcept override
+            {
+                m_allocator->Reset();
+            }
+
+        protected:
+            std::unique_ptr<TAllocator> m_allocator;
+        };
+
+        /// Times the calibrated number of iterations, each of which makes a
+        /// fixed number of allocations and then frees them in reverse order.
+        ///
+        /// @param context_
+        ///        The context of the benchmark.
+        /// @param allocate
+        ///        A function which performs a single allocation, returning a
+        ///        unique pointer to it.
+        /// @param allocationSize
+        ///        The size of each allocation, in bytes.
+        ///
+        template <typename TAllocate> void TimeAllocations(IC::BenchmarkContext& context_, const TAllocate& allocate, std::size_t allocationSize) noexcept
+        {
+            IC_STARTTIMER();
+
+            IC_ITERATE()
+            {
+                auto a = IC_TIMEALLOCATION(allocate());
+                auto b = IC_TIMEALLOCATION(allocate());
+                auto c = IC_TIMEALLOCATION(allocate());
+                auto d = IC_TIMEALLOCATION(allocate());
+
+                IC::TouchMemory(a.get(), allocationSize);
+                IC::TouchMemory(b.get(), allocationSize);
+                IC::TouchMemory(c.get(), allocationSize);
+                IC::TouchMemory(d.get(), allocationSize);
+
+                IC_TIMEDEALLOCATION(d.reset());
+                IC_TIMEDEALLOCATION(c.reset());
+                IC_TIMEDEALLOCATION(b.reset());
+                IC_TIMEDEALLOCATION(a.reset());
+            }
+
+            IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numAllocationsPerIteration);
+            IC_SETNUMALLOCATEDBYTES(IC_NUMITERATIONS() * k_numAllocationsPerIteration * allocationSize);
+        }
+
+        /// @return The space of allocation sizes swept by each benchmark.
+        ///
+        IC::BenchmarkParameterSpace GetAllocationSizes() noexcept
+        {
+            return IC::BenchmarkParameterSpace().Range("size", k_minAllocationSize, k_maxAllocationSize);
+        }
+    }
+
+    /// A benchmark which sweeps the allocation size in powers of two from 8 bytes
+    /// to 64 MB with each general purpose allocator. Comparing the results at each
+    /// size shows where each allocator stops being the best choice.
+    ///
+    IC_BENCHMARKGROUP(AllocationSizeSweep)
+    {
+        /// Performs the benchmark with the standard allocator.
+        ///
+        IC_PARAMETERISEDBENCHMARK(StandardAllocator, GetAllocationSizes())
+        {
+            auto allocationSize = static_cast<std::size_t>(IC_PARAMETER(size));
+
+            TimeAllocations(context_, [=]() { return std::unique_ptr<std::uint8_t[]>(new std::uint8_t[allocationSize]); }, allocationSize);
+        }
+
+        /// Performs the benchmark with a BuddyAllocator sized to fit exactly the
+        /// allocations made in each iteration.
+        ///
+        IC_PARAMETERISEDBENCHMARK(BuddyAllocator, GetAllocationSizes())
+        {
+            auto allocationSize = static_cast<std::size_t>(IC_PARAMETER(size));
+            auto blockSize = std::max<std::size_t>(allocationSize, k_minBuddyBlockSize);
+
+            IC::BuddyAllocator allocator(blockSize * k_numAllocationsPerIteration, blockSize);
+
+            TimeAllocations(context_, [&]() { return IC::MakeUniqueArray<std::uint8_t>(allocator, allocationSize); }, allocationSize);
+        }
+
+        /// Performs the benchmark with a LinearAllocator, which is reset whenever
+        /// it is full.
+        ///
+        IC_PARAMETERISEDFIXTUREBENCHMARK(LinearAllocatorFixture<IC::LinearAllocator>, LinearAllocator, GetAllocationSizes())
+        {
+            auto allocationSize = static_cast<std::size_t>(IC_PARAMETER(size));
+
+            TimeAllocations(context_, [&]() { return IC::MakeUniqueArray<std::uint8_t>(*m_allocator, allocationSize); }, allocationSize);
+        }
+
+        /// Performs the benchmark with a PagedLinearAllocator, which is reset
+        /// whenever its first page is full.
+        ///
+        IC_PARAMETERISEDFIXTUREBENCHMARK(LinearAllocatorFixture<IC::PagedLinearAllocator>, PagedLinearAllocator, GetAllocationSizes())
+        {
+            auto allocationSize = static_cast<std::size_t>(IC_PARAMETER(size));
+
+            TimeAllocations(context_, [&]() { return IC::MakeUniqueArray<std::uint8_t>(*m_allocator, allocationSize); }, allocationSize);
+        }
+
+        /// Performs the benchmark with a BlockAllocator whose block size matches
+        /// the allocation size.
+        ///
+        IC_PARAMETERISEDBENCHMARK(BlockAllocator, GetAllocationSizes())
+        {
+            auto allocationSize = static_cast<std::size_t>(IC_PARAMETER(size));
+
+            IC::BlockAllocator allocator(allocationSize, k_numAllocationsPerIteration);
+
+            TimeAllocations(context_, [&]() { return IC::MakeUniqueArray<std::uint8_t>(allocator, allocationSize); }, allocationSize);
+        }
+
+        /// Performs the benchmark with a PagedBlockAllocator whose block size
+        /// matches the allocation size.
+        ///
+        IC_PARAMETERISEDBENCHMARK(PagedBlockAllocator, GetAllocationSizes())
+        {
+            auto allocationSize = static_cast<std::size_t>(IC_PARAMETER(size));
+
+            IC::PagedBlockAllocator allocator(allocationSize, k_numAllocationsPerIteration);
+
+            TimeAllocations(context_, [&]() { return IC::MakeUniqueArray<std::uint8_t>(allocator, allocationSize); }, allocationSize);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "AllocationReplay.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace ICMemoryBenchmark
+{
+    namespace
+    {
+        const std::string k_benchmarkGroupName = "AllocationTraceReplay";
+
+        /// @return The trace named by the IC_ALLOCATION_TRACE environment
+        /// variable, which is opened the first time this is called and shared
+        /// by every benchmark in the group.
+        ///
+        const IC::AllocationTrace& GetTrace() noexcept
+        {
+            static const IC::AllocationTrace s_trace(std::getenv(IC::AllocationTrace::k_pathVariable));
+            return s_trace;
+        }
+
+        /// Replays every record of the trace against the given allocator, in the
+        /// order they were recorded and on a single thread. Anything the traced
+        /// program never freed is freed after the timer is stopped. The number
+        /// of allocations which fell back to malloc() is reported as the
+        /// "fallbackAllocations" counter.
+        ///
+        /// A replay is a fixed amount of work, so each run replays the trace
+        /// exactly once.
+        ///
+        /// @param context_
+        ///        The context of the benchmark.
+        /// @param allocator
+        ///        The allocator to replay the trace against.
+        ///
+        void ReplayTrace(IC::BenchmarkContext& context_, IC::IAllocator& allocator) noexcept
+        {
+            const auto& trace = GetTrace();
+            std::vector<ReplaySlot> slots(static_cast<std::size_t>(trace.GetNumSlots()));
+
+            IC_STARTTIMER();
+
+            auto result = ReplayRecords(context_, allocator, trace.GetRecords(), trace.GetNumRecords(), slots);
+
+            IC_STOPTIMER();
+
+            FreeReplaySlots(allocator, slots);
+
+            IC_SETNUMOPERATIONS(trace.GetNumRecords());
+            IC_SETNUMALLOCATEDBYTES(result.m_numBytes);
+            IC_SETCOUNTER("fallbackAllocations", result.m_numFallbacks);
+        }
+
+        /// Registers the replay benchmarks, one per allocator, if a trace has
+        /// been provided through the IC_ALLOCATION_TRACE environment variable.
+        /// Traces are recorded with the AllocationTracer tool.
+        ///
+        /// @return Whether or not the benchmarks were registered.
+        ///
+        bool RegisterReplayBenchmarks() noexcept
+        {
+            if (!std::getenv(IC::AllocationTrace::k_pathVariable))
+            {
+                return false;
+            }
+
+            const auto& trace = GetTrace();
+            if (!trace.IsOpen())
+            {
+                std::cerr << k_benchmarkGroupName << ": " << trace.GetError() << std::endl;
+                return false;
+            }
+
+            ReplayRequirements requirements;
+            requirements.m_maxAllocationSize = trace.GetMaxAllocationSize();
+            requirements.m_peakLiveBytes = trace.GetPeakLiveBytes();
+
+            RegisterAllocatorBenchmarks(k_benchmarkGroupName, "", requirements, [](IC::BenchmarkContext& context, IC::IAllocator& allocator, ReplayAllocator) noexcept
+            {
+                ReplayTrace(context, allocator);
+            });
+            return true;
+        }
+
+        const bool k_registered = RegisterReplayBenchmarks();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,158 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICBenchmark/ICBenchmark.h"
+#include "../ICMemory/ICMemory.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace ICMemoryBenchmark
+{
+    namespace
+    {
+        constexpr std::uint64_t k_numLiveAllocations = 64;
+        constexpr std::size_t k_allocationSize = 64;
+
+        /// A small example struct, of the same size as each allocation.
+        ///
+        struct Object final
+        {
+            std::uint64_t m_values[k_allocationSize / sizeof(std::uint64_t)];
+        };
+
+        constexpr std::uint64_t k_numIterationsPerReset = 16;
+
+        /// A fixture which owns a PagedLinearAllocator with the page size given by
+        /// the "pageSize" parameter. The allocator is reset every
+        /// k_numIterationsPerReset iterations with the timer paused, so the cost
+        /// of pausing the timer is spread over them.
+        ///
+        class PagedLinearAllocatorFixture : public IC::BenchmarkFixture
+        {
+        public:
+            void SetUp(const IC::BenchmarkParameters& parameters) noexcept override
+            {
+                SetIterationInterval(k_numIterationsPerReset);
+                m_allocator.reset(new IC::PagedLinearAllocator(static_cast<std::size_t>(parameters.Get("pageSize"))));
+            }
+
+            void TearDown() noexcept override
+            {
+                m_allocator.reset();
+            }
+
+            void TearDownIteration() noexcept override
+            {
+                m_allocator->Reset();
+            }
+
+        protected:
+            std::unique_ptr<IC::PagedLinearAllocator> m_allocator;
+        };
+
+        /// Times the calibrated number of iterations, each of which makes a
+        /// fixed number of allocations, keeping them all live, and then frees
+        /// them in reverse order.
+        ///
+        /// @param context_
+        ///        The context of the benchmark.
+        /// @param allocate
+        ///        A function which performs a single allocation, returning a
+        ///        unique pointer to it.
+        ///
+        template <typename TAllocate> void TimeLiveAllocations(IC::BenchmarkContext& context_, const TAllocate& allocate) noexcept
+        {
+            std::vector<decltype(allocate())> allocations;
+            allocations.reserve(k_numLiveAllocations);
+
+            IC_STARTTIMER();
+
+            IC_ITERATE()
+            {
+                for (std::uint64_t i = 0; i < k_numLiveAllocations; ++i)
+                {
+                    allocations.push_back(IC_TIMEALLOCATION(allocate()));
+                    IC::TouchMemory(allocations.back().get(), k_allocationSize);
+                }
+
+                while (!allocations.empty())
+                {
+                    IC_TIMEDEALLOCATION(allocations.back().reset());
+                    allocations.pop_back();
+                }
+            }
+
+            IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numLiveAllocations);
+            IC_SETNUMALLOCATEDBYTES(IC_NUMITERATIONS() * k_numLiveAllocations * k_allocationSize);
+        }
+    }
+
+    /// A benchmark which holds a fixed number of small allocations live while
+    /// sweeping the configuration of each allocator: the buffer size of a buddy
+    /// allocator, the page size of a paged linear allocator and the number of
+    /// blocks or objects per page of the paged block allocator and pool.
+    ///
+    IC_BENCHMARKGROUP(AllocatorConfiguration)
+    {
+        /// Performs the benchmark with a BuddyAllocator of varying buffer size.
+        /// Larger buffers have more levels to search and split.
+        ///
+        IC_PARAMETERISEDBENCHMARK(BuddyAllocator, IC::BenchmarkParameterSpace().Range("poolSize", 64 * 1024, 64 * 1024 * 1024, 4))
+        {
+            IC::BuddyAllocator allocator(static_cast<std::size_t>(IC_PARAMETER(poolSize)), k_allocationSize);
+
+            TimeLiveAllocations(context_, [&]() { return IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize); });
+        }
+
+        /// Performs the benchmark with a PagedLinearAllocator of varying page
+        /// size, which is reset every k_numIterationsPerReset iterations.
+        ///
+        IC_PARAMETERISEDFIXTUREBENCHMARK(PagedLinearAllocatorFixture, PagedLinearAllocator, IC::BenchmarkParameterSpace().Range("pageSize", 1024, 1024 * 1024, 4))
+        {
+            TimeLiveAllocations(context_, [&]() { return IC::MakeUniqueArray<std::uint8_t>(*m_allocator, k_allocationSize); });
+        }
+
+        /// Performs the benchmark with a PagedBlockAllocator with a varying
+        /// number of blocks per page.
+        ///
+        IC_PARAMETERISEDBENCHMARK(PagedBlockAllocator, IC::BenchmarkParameterSpace().Range("blockCount", 1, 256, 4))
+        {
+            IC::PagedBlockAllocator allocator(k_allocationSize, static_cast<std::size_t>(IC_PARAMETER(blockCount)));
+
+            TimeLiveAllocations(context_, [&]() { return IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize); });
+        }
+
+        /// Performs the benchmark with a PagedObjectPool with a varying number
+        /// of objects per page.
+        ///
+        IC_PARAMETERISEDBENCHMARK(PagedObjectPool, IC::BenchmarkParameterSpace().Range("poolSize", 1, 256, 4))
+        {
+            IC::PagedObjectPool<Object> pool(static_cast<std::size_t>(IC_PARAMETER(poolSize)));
+
+            TimeLiveAllocations(context_, [&]() { return pool.Create(); });
+        }
+    }
+}
\ No newline at end of file
@@ -25,15 +25,14 @@
 #include "../ICBenchmark/ICBenchmark.h"
 #include "../ICMemory/ICMemory.h"
 
-#include <array>
+#include <algorithm>
 #include <thread>
 
 namespace ICMemoryBenchmark
 {
     namespace
     {
-        constexpr std::int32_t k_numThreads = 8;
-        constexpr std::int32_t k_numIterationsPerThread = 1000000;
+        constexpr std::int32_t k_numAllocationsPerIteration = 3;
 
         /// A small example struct.
         ///
@@ -45,73 +44,76 @@ namespace ICMemoryBenchmark
             std::uint64_t m_d;
         };
 
+        constexpr std::size_t k_numBytesPerIteration = sizeof(std::uint32_t) + sizeof(std::uint64_t) + sizeof(SmallStruct);
+
+        /// @return The space of thread counts to sweep: powers of two from one
+        /// up to the number of online cores, which is always included.
+        ///
+        IC::BenchmarkParameterSpace GetThreadCounts() noexcept
+        {
+            auto numCores = std::max(1u, std::thread::hardware_concurrency());
+            return IC::BenchmarkParameterSpace().Range(IC::ThreadScaling::k_threadsParameter, 1, numCores);
+        }
     }
 
     /// A benchmark for measuring the time taken to perform a large number of
-    /// allocations concurrently.
+    /// allocations concurrently. Each benchmark is run with a range of thread
+    /// counts so that the scaling of each allocator can be seen.
     ///
     IC_BENCHMARKGROUP(ConcurrentAllocations)
     {
         /// Performs the benchmark with the standard allocator.
         ///
-        IC_BENCHMARK(StandardAllocator)
+        IC_PARAMETERISEDBENCHMARK(StandardAllocator, GetThreadCounts())
         {
-            std::vector<std::thread> threads;
-
-            IC_STARTTIMER();
+            auto numThreads = IC_PARAMETER(threads);
+            auto numIterationsPerThread = IC_NUMITERATIONS();
 
-            for (int i = 0; i < k_numThreads; ++i)
+            IC_RUNTHREADS(numThreads, [numIterationsPerThread](std::uint32_t) noexcept
             {
-                threads.push_back(std::thread([]()
+                for (std::uint64_t j = 0; j < numIterationsPerThread; ++j)
                 {
-                    for (int j = 0; j < k_numIterationsPerThread; ++j)
-                    {
-                        auto a = std::unique_ptr<std::uint32_t>(new uint32_t);
-                        auto b = std::unique_ptr<std::uint64_t>(new uint64_t);
-                        auto e = std::unique_ptr<SmallStruct>(new SmallStruct());
-                    }
-                }));
-            }
-
-            for (auto& thread : threads)
-            {
-                thread.join();
-            }
-
-            IC_STOPTIMER();
+                    auto a = std::unique_ptr<std::uint32_t>(new uint32_t);
+                    auto b = std::unique_ptr<std::uint64_t>(new uint64_t);
+                    auto e = std::unique_ptr<SmallStruct>(new SmallStruct());
+
+                    IC::TouchMemory(a.get(), sizeof(*a));
+                    IC::TouchMemory(b.get(), sizeof(*b));
+                    IC::TouchMemory(e.get(), sizeof(*e));
+                }
+            });
+
+            IC_SETNUMOPERATIONS(numThreads * numIterationsPerThread * k_numAllocationsPerIteration);
+            IC_SETNUMALLOCATEDBYTES(numThreads * numIterationsPerThread * k_numBytesPerIteration);
         }
 
-        /// Performs the benchmark with a BuddyAllocator.
+        /// Performs the benchmark with a BuddyAllocator shared by all threads.
         ///
-        IC_BENCHMARK(BuddyAllocator)
+        IC_PARAMETERISEDBENCHMARK(BuddyAllocator, GetThreadCounts())
         {
             constexpr std::size_t k_allocatorSize = 4 * 1024;
 
             IC::BuddyAllocator allocator(k_allocatorSize);
 
-            std::vector<std::thread> threads;
-
-            IC_STARTTIMER();
+            auto numThreads = IC_PARAMETER(threads);
+            auto numIterationsPerThread = IC_NUMITERATIONS();
 
-            for (int i = 0; i < k_numThreads; ++i)
+            IC_RUNTHREADS(numThreads, [&allocator, numIterationsPerThread](std::uint32_t) noexcept
             {
-                threads.push_back(std::thread([&allocator]()
+                for (std::uint64_t j = 0; j < numIterationsPerThread; ++j)
                 {
-                    for (int j = 0; j < k_numIterationsPerThread; ++j)
-                    {
-                        auto a = IC::MakeUnique<std::uint32_t>(allocator);
-                        auto b = IC::MakeUnique<std::uint64_t>(allocator);
-                        auto c = IC::MakeUnique<SmallStruct>(allocator);
-                    }
-                }));
-            }
-
-            for (auto& thread : threads)
-            {
-                thread.join();
-            }
-
-            IC_STOPTIMER();
+                    auto a = IC::MakeUnique<std::uint32_t>(allocator);
+                    auto b = IC::MakeUnique<std::uint64_t>(allocator);
+                    auto c = IC::MakeUnique<SmallStruct>(allocator);
+
+                    IC::TouchMemory(a.get(), sizeof(*a));
+                    IC::TouchMemory(b.get(), sizeof(*b));
+                    IC::TouchMemory(c.get(), sizeof(*c));
+                }
+            });
+
+            IC_SETNUMOPERATIONS(numThreads * numIterationsPerThread * k_numAllocationsPerIteration);
+            IC_SETNUMALLOCATEDBYTES(numThreads * numIterationsPerThread * k_numBytesPerIteration);
         }
     }
 }
\ No newline at end of file
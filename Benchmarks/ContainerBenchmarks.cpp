@@ -0,0 +1,440 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICBenchmark/ICBenchmark.h"
+#include "../ICMemory/ICMemory.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <queue>
+#include <stack>
+#include <string>
+#include <vector>
+
+namespace ICMemoryBenchmark
+{
+    /// Benchmarks comparing the IC containers, backed by a BuddyAllocator, against
+    /// their std equivalents with the default allocator, for element sizes from 4
+    /// to 256 bytes. Each container has a group per operation, named after the
+    /// container and the operation, such as VectorPushPop.
+    ///
+    namespace
+    {
+        constexpr std::uint64_t k_numElements = 1024;
+        constexpr std::uint64_t k_numIterationElements = 4096;
+        constexpr std::size_t k_buddyAllocatorSize = 16 * 1024 * 1024;
+        constexpr std::size_t k_buddyMinBlockSize = 16;
+
+        /// An element of a container, of the given size in bytes.
+        ///
+        template <std::size_t TSize> struct Element final
+        {
+            std::uint8_t m_bytes[TSize];
+        };
+
+        /// Adds an element to the back of a sequence container.
+        ///
+        struct PushBack final
+        {
+            template <typename TContainer, typename TValue> void operator()(TContainer& container, const TValue& value) const noexcept { container.push_back(value); }
+        };
+
+        /// Removes the element at the back of a sequence container.
+        ///
+        struct PopBack final
+        {
+            template <typename TContainer> void operator()(TContainer& container) const noexcept { container.pop_back(); }
+        };
+
+        /// Removes the element at the front of a sequence container.
+        ///
+        struct PopFront final
+        {
+            template <typename TContainer> void operator()(TContainer& container) const noexcept { container.pop_front(); }
+        };
+
+        /// Adds an element to a container adaptor, such as a queue or stack.
+        ///
+        struct Push final
+        {
+            template <typename TContainer, typename TValue> void operator()(TContainer& container, const TValue& value) const noexcept { container.push(value); }
+        };
+
+        /// Removes the next element from a container adaptor, such as a queue
+        /// or stack.
+        ///
+        struct Pop final
+        {
+            template <typename TContainer> void operator()(TContainer& container) const noexcept { container.pop(); }
+        };
+
+        /// @return The space of element sizes swept by each benchmark, in
+        /// bytes: 4, 16, 64 and 256.
+        ///
+        IC::BenchmarkParameterSpace GetElementSizes() noexcept
+        {
+            return IC::BenchmarkParameterSpace().Range("size", 4, 256, 4);
+        }
+
+        /// @param value
+        ///        The value of the element, which is truncated to a byte.
+        ///
+        /// @return An element with the given value in its first byte.
+        ///
+        template <typename TElement> TElement MakeElement(std::uint64_t value) noexcept
+        {
+            TElement element = {};
+            element.m_bytes[0] = static_cast<std::uint8_t>(value);
+            return element;
+        }
+
+        /// Calls the given function with a default constructed element of the
+        /// given size, so that the element type can be chosen from a benchmark
+        /// parameter.
+        ///
+        /// @param size
+        ///        The element size, one of those in GetElementSizes().
+        /// @param function
+        ///        The function, which takes an element by value.
+        ///
+        template <typename TFunction> void DispatchElementSize(std::uint64_t size, const TFunction& function) noexcept
+        {
+            switch (size)
+            {
+            case 4:
+                function(Element<4>());
+                break;
+            case 16:
+                function(Element<16>());
+                break;
+            case 64:
+                function(Element<64>());
+                break;
+            case 256:
+                function(Element<256>());
+                break;
+            default:
+                break;
+            }
+        }
+
+        /// Times the calibrated number of iterations, each of which adds
+        /// k_numElements elements to the same container and then removes them
+        /// all again. As the container is reused, this measures steady state
+        /// use once it has grown.
+        ///
+        /// @param context_
+        ///        The context of the benchmark.
+        /// @param create
+        ///        A function which creates an empty container.
+        /// @param push
+        ///        A function which adds the given element to the container.
+        /// @param pop
+        ///        A function which removes an element from the container.
+        ///
+        template <typename TCreate, typename TPush, typename TPop>
+        void TimePushPop(IC::BenchmarkContext& context_, const TCreate& create, const TPush& push, const TPop& pop) noexcept
+        {
+            using Container = decltype(create());
+            using Value = typename Container::value_type;
+
+            auto container = create();
+
+            IC_STARTTIMER();
+
+            IC_ITERATE()
+            {
+                for (std::uint64_t i = 0; i < k_numElements; ++i)
+                {
+                    push(container, MakeElement<Value>(i));
+                }
+
+                for (std::uint64_t i = 0; i < k_numElements; ++i)
+                {
+                    pop(container);
+                }
+            }
+
+            IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numElements * 2);
+        }
+
+        /// Times the calibrated number of iterations, each of which creates a
+        /// new container, adds k_numElements elements to it and destroys it.
+        /// This measures the cost of the allocations made as it grows.
+        ///
+        /// @param context_
+        ///        The context of the benchmark.
+        /// @param create
+        ///        A function which creates an empty container.
+        /// @param push
+        ///        A function which adds the given element to the container.
+        ///
+        template <typename TCreate, typename TPush> void TimeGrowth(IC::BenchmarkContext& context_, const TCreate& create, const TPush& push) noexcept
+        {
+            using Container = decltype(create());
+            using Value = typename Container::value_type;
+
+            IC_STARTTIMER();
+
+            IC_ITERATE()
+            {
+                auto container = create();
+                for (std::uint64_t i = 0; i < k_numElements; ++i)
+                {
+                    push(container, MakeElement<Value>(i));
+                }
+
+                IC::DoNotOptimise(container);
+            }
+
+            IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numElements);
+        }
+
+        /// Times the calibrated number of iterations, each of which reads every
+        /// element of a sequence container filled with k_numIterationElements
+        /// elements outside of the timer.
+        ///
+        /// @param context_
+        ///        The context of the benchmark.
+        /// @param create
+        ///        A function which creates an empty sequence container.
+        ///
+        template <typename TCreate> void TimeIteration(IC::BenchmarkContext& context_, const TCreate& create) noexcept
+        {
+            using Container = decltype(create());
+            using Value = typename Container::value_type;
+
+            auto container = create();
+            for (std::uint64_t i = 0; i < k_numIterationElements; ++i)
+            {
+                container.push_back(MakeElement<Value>(i));
+            }
+
+            IC_STARTTIMER();
+
+            IC_ITERATE()
+            {
+                std::uint64_t sum = 0;
+                for (const auto& element : container)
+                {
+                    sum += element.m_bytes[0];
+                }
+
+                IC::DoNotOptimise(sum);
+            }
+
+            IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numIterationElements);
+        }
+
+        /// Times the calibrated number of iterations, each of which inserts an
+        /// element into the middle of a sequence container holding
+        /// k_numElements elements and then erases it again.
+        ///
+        /// @param context_
+        ///        The context of the benchmark.
+        /// @param create
+        ///        A function which creates an empty sequence container.
+        ///
+        template <typename TCreate> void TimeInsertErase(IC::BenchmarkContext& context_, const TCreate& create) noexcept
+        {
+            using Container = decltype(create());
+            using Value = typename Container::value_type;
+
+            auto container = create();
+            for (std::uint64_t i = 0; i < k_numElements; ++i)
+            {
+                container.push_back(MakeElement<Value>(i));
+            }
+
+            auto middle = static_cast<std::ptrdiff_t>(k_numElements / 2);
+
+            IC_STARTTIMER();
+
+            IC_ITERATE()
+            {
+                container.insert(container.begin() + middle, MakeElement<Value>(iteration_.GetIndex()));
+                container.erase(container.begin() + middle);
+            }
+
+            IC_STOPTIMER();
+
+            IC::DoNotOptimise(container);
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * 2);
+        }
+
+        /// Times the calibrated number of iterations, each of which fills the
+        /// same sequence container with k_numElements elements and then clears
+        /// it, so that later iterations reuse whatever memory the container
+        /// keeps after being cleared.
+        ///
+        /// @param context_
+        ///        The context of the benchmark.
+        /// @param create
+        ///        A function which creates an empty sequence container.
+        ///
+        template <typename TCreate> void TimeClearAndReuse(IC::BenchmarkContext& context_, const TCreate& create) noexcept
+        {
+            using Container = decltype(create());
+            using Value = typename Container::value_type;
+
+            auto container = create();
+
+            IC_STARTTIMER();
+
+            IC_ITERATE()
+            {
+                for (std::uint64_t i = 0; i < k_numElements; ++i)
+                {
+                    container.push_back(MakeElement<Value>(i));
+                }
+
+                container.clear();
+            }
+
+            IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numElements);
+        }
+
+        /// Creates the containers compared by the vector benchmarks.
+        ///
+        struct VectorFactory final
+        {
+            template <typename TValue> static std::vector<TValue> CreateStandard() noexcept { return std::vector<TValue>(); }
+            template <typename TValue> static auto CreateIC(IC::IAllocator& allocator) noexcept { return IC::MakeVector<TValue>(allocator); }
+        };
+
+        /// Creates the containers compared by the deque benchmarks.
+        ///
+        struct DequeFactory final
+        {
+            template <typename TValue> static std::deque<TValue> CreateStandard() noexcept { return std::deque<TValue>(); }
+            template <typename TValue> static auto CreateIC(IC::IAllocator& allocator) noexcept { return IC::MakeDeque<TValue>(allocator); }
+        };
+
+        /// Creates the containers compared by the queue benchmarks.
+        ///
+        struct QueueFactory final
+        {
+            template <typename TValue> static std::queue<TValue> CreateStandard() noexcept { return std::queue<TValue>(); }
+            template <typename TValue> static auto CreateIC(IC::IAllocator& allocator) noexcept { return IC::MakeQueue<TValue>(allocator); }
+        };
+
+        /// Creates the containers compared by the stack benchmarks.
+        ///
+        struct StackFactory final
+        {
+            template <typename TValue> static std::stack<TValue> CreateStandard() noexcept { return std::stack<TValue>(); }
+            template <typename TValue> static auto CreateIC(IC::IAllocator& allocator) noexcept { return IC::MakeStack<TValue>(allocator); }
+        };
+
+        /// Registers a benchmark group which compares the std container created by
+        /// the given factory, using the standard allocator, against its IC
+        /// equivalent backed by a BuddyAllocator. Each is registered once for
+        /// every element size.
+        ///
+        /// @param benchmarkGroupName
+        ///        The name of the benchmark group.
+        /// @param time
+        ///        A function which times a container, taking the benchmark context
+        ///        and a function which creates an empty container.
+        ///
+        template <typename TFactory, typename TTime> void RegisterContainerGroup(const std::string& benchmarkGroupName, const TTime& time) noexcept
+        {
+            const IC::AutoRegisterBenchmark standardAllocator(benchmarkGroupName, "StandardAllocator", GetElementSizes(),
+                [=](IC::BenchmarkContext& context, const IC::BenchmarkParameters& parameters) noexcept
+            {
+                DispatchElementSize(parameters.Get("size"), [&](auto element)
+                {
+                    using Value = decltype(element);
+                    time(context, []() { return TFactory::template CreateStandard<Value>(); });
+                });
+            });
+
+            const IC::AutoRegisterBenchmark buddyAllocator(benchmarkGroupName, "BuddyAllocator", GetElementSizes(),
+                [=](IC::BenchmarkContext& context, const IC::BenchmarkParameters& parameters) noexcept
+            {
+                IC::BuddyAllocator allocator(k_buddyAllocatorSize, k_buddyMinBlockSize);
+
+                DispatchElementSize(parameters.Get("size"), [&](auto element)
+                {
+                    using Value = decltype(element);
+                    time(context, [&]() { return TFactory::template CreateIC<Value>(allocator); });
+                });
+            });
+        }
+
+        /// Registers the PushPop, Growth, Iteration, InsertErase and
+        /// ClearAndReuse groups for a sequence container, each prefixed with the
+        /// name of the container.
+        ///
+        /// @param containerName
+        ///        The name of the container, such as "Vector".
+        /// @param pop
+        ///        A function which removes an element from the container. Elements
+        ///        are always added to the back.
+        ///
+        template <typename TFactory, typename TPop> void RegisterSequenceContainerGroups(const std::string& containerName, const TPop& pop) noexcept
+        {
+            RegisterContainerGroup<TFactory>(containerName + "PushPop", [=](IC::BenchmarkContext& context, const auto& create) { TimePushPop(context, create, PushBack(), pop); });
+            RegisterContainerGroup<TFactory>(containerName + "Growth", [](IC::BenchmarkContext& context, const auto& create) { TimeGrowth(context, create, PushBack()); });
+            RegisterContainerGroup<TFactory>(containerName + "Iteration", [](IC::BenchmarkContext& context, const auto& create) { TimeIteration(context, create); });
+            RegisterContainerGroup<TFactory>(containerName + "InsertErase", [](IC::BenchmarkContext& context, const auto& create) { TimeInsertErase(context, create); });
+            RegisterContainerGroup<TFactory>(containerName + "ClearAndReuse", [](IC::BenchmarkContext& context, const auto& create) { TimeClearAndReuse(context, create); });
+        }
+
+        /// Registers the PushPop and Growth groups for a container adaptor, each
+        /// prefixed with the name of the container.
+        ///
+        /// @param containerName
+        ///        The name of the container, such as "Queue".
+        ///
+        template <typename TFactory> void RegisterContainerAdaptorGroups(const std::string& containerName) noexcept
+        {
+            RegisterContainerGroup<TFactory>(containerName + "PushPop", [](IC::BenchmarkContext& context, const auto& create) { TimePushPop(context, create, Push(), Pop()); });
+            RegisterContainerGroup<TFactory>(containerName + "Growth", [](IC::BenchmarkContext& context, const auto& create) { TimeGrowth(context, create, Push()); });
+        }
+
+        /// Registers the benchmark groups for every container.
+        ///
+        /// @return Whether or not the benchmarks were registered.
+        ///
+        bool RegisterContainers() noexcept
+        {
+            RegisterSequenceContainerGroups<VectorFactory>("Vector", PopBack());
+            RegisterSequenceContainerGroups<DequeFactory>("Deque", PopFront());
+            RegisterContainerAdaptorGroups<QueueFactory>("Queue");
+            RegisterContainerAdaptorGroups<StackFactory>("Stack");
+            return true;
+        }
+
+        const bool k_registered = RegisterContainers();
+    }
+}
\ No newline at end of file
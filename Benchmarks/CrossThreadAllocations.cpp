@@ -0,0 +1,250 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICBenchmark/ICBenchmark.h"
+#include "../ICMemory/ICMemory.h"
+#include "LockingAllocator.h"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ICMemoryBenchmark
+{
+    namespace
+    {
+        constexpr std::size_t k_messageSize = 64;
+        constexpr std::size_t k_queueCapacity = 1024;
+        constexpr std::size_t k_buddyAllocatorSize = 16 * 1024 * 1024;
+
+        /// An example message, of the same size as each allocation.
+        ///
+        struct Message final
+        {
+            std::uint64_t m_values[k_messageSize / sizeof(std::uint64_t)];
+        };
+
+        /// @return The space of thread counts to sweep: even numbers of threads,
+        /// doubling from two up to the number of online cores, which is always
+        /// included if it is even. Half of the threads are producers and half
+        /// are consumers.
+        ///
+        IC::BenchmarkParameterSpace GetThreadCounts() noexcept
+        {
+            auto numCores = std::max(2u, std::thread::hardware_concurrency()) & ~1u;
+            return IC::BenchmarkParameterSpace().Range(IC::ThreadScaling::k_threadsParameter, 2, numCores);
+        }
+
+        /// @param numThreads
+        ///        The total number of producer and consumer threads.
+        ///
+        /// @return The largest number of messages which can be in flight at
+        /// once: a full queue per pair of threads, plus the message each
+        /// producer and each consumer is holding.
+        ///
+        std::size_t GetMaxMessagesInFlight(std::uint64_t numThreads) noexcept
+        {
+            return static_cast<std::size_t>(numThreads / 2) * (k_queueCapacity + 2);
+        }
+
+        /// @param pointer
+        ///        A raw pointer to an allocation.
+        ///
+        /// @return The address of the allocation.
+        ///
+        template <typename TValue> void* GetAddress(TValue* pointer) noexcept
+        {
+            return pointer;
+        }
+
+        /// @param pointer
+        ///        A unique pointer to an allocation.
+        ///
+        /// @return The address of the allocation.
+        ///
+        template <typename TValue> void* GetAddress(const IC::UniquePtr<TValue>& pointer) noexcept
+        {
+            return pointer.get();
+        }
+
+        /// Runs pairs of threads in which a producer allocates messages and
+        /// passes them through a lock-free queue to a consumer, which frees them,
+        /// so that every deallocation is made on a different thread to the
+        /// allocation. Each producer sends the calibrated number of messages.
+        ///
+        /// If latencies are being recorded, the allocation latencies on the
+        /// producers and the remote deallocation latencies on the consumers are
+        /// recorded per thread and merged once all threads complete.
+        ///
+        /// @param context_
+        ///        The context of the benchmark.
+        /// @param parameters_
+        ///        The parameters of the benchmark, including the thread count.
+        /// @param allocate
+        ///        A function which allocates a single message.
+        /// @param deallocate
+        ///        A function which frees the given message.
+        ///
+        template <typename TAllocate, typename TDeallocate>
+        void TimeCrossThreadAllocations(IC::BenchmarkContext& context_, const IC::BenchmarkParameters& parameters_, const TAllocate& allocate,
+            const TDeallocate& deallocate) noexcept
+        {
+            using Pointer = decltype(allocate());
+
+            auto numPairs = static_cast<std::uint32_t>(IC_PARAMETER(threads) / 2);
+            auto numMessagesPerPair = IC_NUMITERATIONS();
+
+            std::vector<std::unique_ptr<IC::SpscQueue<Pointer>>> queues;
+            for (std::uint32_t i = 0; i < numPairs; ++i)
+            {
+                queues.push_back(std::unique_ptr<IC::SpscQueue<Pointer>>(new IC::SpscQueue<Pointer>(k_queueCapacity)));
+            }
+
+            auto recordLatencies = context_.GetAllocationLatencies() && context_.GetDeallocationLatencies();
+            std::vector<IC::LatencyHistogram> allocationLatencies(recordLatencies ? numPairs : 0);
+            std::vector<IC::LatencyHistogram> deallocationLatencies(recordLatencies ? numPairs : 0);
+
+            IC_RUNTHREADS(numPairs * 2, [&](std::uint32_t threadIndex) noexcept
+            {
+                auto pairIndex = threadIndex % numPairs;
+                auto& queue = *queues[pairIndex];
+
+                if (threadIndex < numPairs)
+                {
+                    auto latencies = recordLatencies ? &allocationLatencies[pairIndex] : nullptr;
+                    for (std::uint64_t j = 0; j < numMessagesPerPair; ++j)
+                    {
+                        auto message = (IC::LatencyProbe(latencies), allocate());
+                        IC::TouchMemory(GetAddress(message), k_messageSize);
+                        queue.Push(std::move(message));
+                    }
+                }
+                else
+                {
+                    auto latencies = recordLatencies ? &deallocationLatencies[pairIndex] : nullptr;
+                    for (std::uint64_t j = 0; j < numMessagesPerPair; ++j)
+                    {
+                        auto message = queue.Pop();
+                        (IC::LatencyProbe(latencies), deallocate(message));
+                    }
+                }
+            });
+
+            for (std::uint32_t i = 0; recordLatencies && i < numPairs; ++i)
+            {
+                context_.GetAllocationLatencies()->Merge(allocationLatencies[i]);
+                context_.GetDeallocationLatencies()->Merge(deallocationLatencies[i]);
+            }
+
+            IC_SETNUMOPERATIONS(numPairs * numMessagesPerPair * 2);
+            IC_SETNUMALLOCATEDBYTES(numPairs * numMessagesPerPair * k_messageSize);
+        }
+
+        /// Times cross-thread allocations with the given allocator.
+        ///
+        /// @param context_
+        ///        The context of the benchmark.
+        /// @param parameters_
+        ///        The parameters of the benchmark, including the thread count.
+        /// @param allocator
+        ///        The allocator, which must be thread-safe.
+        ///
+        void TimeCrossThreadAllocations(IC::BenchmarkContext& context_, const IC::BenchmarkParameters& parameters_, IC::IAllocator& allocator) noexcept
+        {
+            TimeCrossThreadAllocations(context_, parameters_, [&]() { return allocator.Allocate(k_messageSize); }, [&](void* message) { allocator.Deallocate(message); });
+        }
+    }
+
+    /// A benchmark for measuring the cost of freeing memory on a different
+    /// thread to the one which allocated it, as happens when one thread
+    /// creates a message and another consumes it. This is the worst case for
+    /// many pool allocators and isn't covered by ConcurrentAllocations, in
+    /// which every thread frees its own allocations.
+    ///
+    /// Allocators which aren't thread-safe are wrapped in a LockingAllocator.
+    /// The growth in memory usage caused by remote frees is shown by the
+    /// resource usage of each run.
+    ///
+    IC_BENCHMARKGROUP(CrossThreadAllocations)
+    {
+        /// Performs the benchmark with the standard allocator.
+        ///
+        IC_PARAMETERISEDBENCHMARK(StandardAllocator, GetThreadCounts())
+        {
+            TimeCrossThreadAllocations(context_, parameters_, []() { return new Message(); }, [](Message* message) { delete message; });
+        }
+
+        /// Performs the benchmark with a BuddyAllocator shared by all threads.
+        ///
+        IC_PARAMETERISEDBENCHMARK(BuddyAllocator, GetThreadCounts())
+        {
+            IC::BuddyAllocator allocator(k_buddyAllocatorSize, k_messageSize);
+
+            TimeCrossThreadAllocations(context_, parameters_, allocator);
+        }
+
+        /// Performs the benchmark with a BlockAllocator large enough for every
+        /// message that can be in flight, behind a lock.
+        ///
+        IC_PARAMETERISEDBENCHMARK(BlockAllocator, GetThreadCounts())
+        {
+            IC::BlockAllocator allocator(k_messageSize, GetMaxMessagesInFlight(IC_PARAMETER(threads)));
+            LockingAllocator lockingAllocator(allocator);
+
+            TimeCrossThreadAllocations(context_, parameters_, lockingAllocator);
+        }
+
+        /// Performs the benchmark with a SmallObjectAllocator, behind a lock.
+        ///
+        IC_PARAMETERISEDBENCHMARK(SmallObjectAllocator, GetThreadCounts())
+        {
+            IC::SmallObjectAllocator allocator(GetMaxMessagesInFlight(IC_PARAMETER(threads)) * k_messageSize);
+            LockingAllocator lockingAllocator(allocator);
+
+            TimeCrossThreadAllocations(context_, parameters_, lockingAllocator);
+        }
+
+        /// Performs the benchmark with an ObjectPool large enough for every
+        /// message that can be in flight. Creation and destruction are
+        /// serialised through a mutex, as the pool isn't thread-safe.
+        ///
+        IC_PARAMETERISEDBENCHMARK(ObjectPool, GetThreadCounts())
+        {
+            IC::ObjectPool<Message> pool(GetMaxMessagesInFlight(IC_PARAMETER(threads)));
+            std::mutex mutex;
+
+            TimeCrossThreadAllocations(context_, parameters_,
+                [&]()
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    return pool.Create();
+                },
+                [&](IC::UniquePtr<Message>& message)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    message.reset();
+                });
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,458 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../ICBenchmark/ICBenchmark.h"
+#include "../ICMemory/ICMemory.h"
+
+#include <algorithm>
+#include <new>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ICMemoryBenchmark
+{
+    namespace
+    {
+        const std::string k_benchmarkGroupName = "DataLocality";
+
+        constexpr std::uint32_t k_numNodes = 64 * 1024;
+        constexpr std::uint32_t k_nodesPerBucket = 4;
+        constexpr std::uint32_t k_numChurnRounds = 4;
+        constexpr std::uint32_t k_seed = 1;
+        constexpr std::size_t k_numBlocksPerPage = 1024;
+
+        /// The linked structures which can be built and traversed.
+        ///
+        enum class Structure
+        {
+            k_list,
+            k_tree,
+            k_hashTable
+        };
+
+        /// A node of any of the linked structures, padded to a typical cache
+        /// line. A list or hash bucket only uses the first link, while a tree
+        /// uses both as its left and right children.
+        ///
+        struct Node final
+        {
+            Node* m_links[2];
+            std::uint64_t m_key;
+            std::uint64_t m_value;
+            std::uint64_t m_payload[4];
+        };
+
+        /// A linked structure built from a set of nodes. Only the members for
+        /// the type of structure are used.
+        ///
+        struct LinkedStructure final
+        {
+            Node* m_head = nullptr;
+            std::vector<Node*> m_buckets;
+        };
+
+        /// @param structure
+        ///        The structure.
+        ///
+        /// @return The name of the structure, as used in benchmark names.
+        ///
+        std::string GetName(Structure structure) noexcept
+        {
+            switch (structure)
+            {
+            case Structure::k_list:
+                return "List";
+            case Structure::k_tree:
+                return "Tree";
+            case Structure::k_hashTable:
+                return "HashTable";
+            default:
+                return "Unknown";
+            }
+        }
+
+        /// @param pointer
+        ///        A raw pointer to a node.
+        ///
+        /// @return The node.
+        ///
+        Node* GetNode(Node* pointer) noexcept
+        {
+            return pointer;
+        }
+
+        /// @param pointer
+        ///        A unique pointer to a node.
+        ///
+        /// @return The node.
+        ///
+        Node* GetNode(const IC::UniquePtr<Node>& pointer) noexcept
+        {
+            return pointer.get();
+        }
+
+        /// Shuffles the given indices with a Fisher-Yates shuffle, so that the
+        /// order is the same on every platform.
+        ///
+        /// @param random
+        ///        The random number generator.
+        /// @param out_indices
+        ///        (Out) The indices to shuffle.
+        ///
+        void Shuffle(std::mt19937& random, std::vector<std::uint32_t>& out_indices) noexcept
+        {
+            for (auto i = static_cast<std::uint32_t>(out_indices.size()); i > 1; --i)
+            {
+                std::swap(out_indices[i - 1], out_indices[random() % i]);
+            }
+        }
+
+        /// @param key
+        ///        A key.
+        /// @param numBuckets
+        ///        The number of buckets in the hash table.
+        ///
+        /// @return The bucket the key belongs in.
+        ///
+        std::size_t GetBucket(std::uint64_t key, std::size_t numBuckets) noexcept
+        {
+            return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) % numBuckets;
+        }
+
+        /// Links the given nodes into a structure. A list links the nodes in
+        /// order, so it follows the order they were allocated in unless they
+        /// were churned. A tree inserts them by key into an unbalanced binary
+        /// search tree and a hash table chains them into buckets by key; as
+        /// the keys are a random permutation both visit nodes in an order
+        /// unrelated to allocation.
+        ///
+        /// @param structure
+        ///        The type of structure.
+        /// @param nodes
+        ///        The nodes, whose keys must already be set.
+        ///
+        /// @return The linked structure.
+        ///
+        LinkedStructure LinkNodes(Structure structure, const std::vector<Node*>& nodes) noexcept
+        {
+            LinkedStructure linked;
+
+            switch (structure)
+            {
+            case Structure::k_list:
+                for (auto i = nodes.size(); i > 0; --i)
+                {
+                    nodes[i - 1]->m_links[0] = linked.m_head;
+                    linked.m_head = nodes[i - 1];
+                }
+                break;
+            case Structure::k_tree:
+                for (auto node : nodes)
+                {
+                    auto link = &linked.m_head;
+                    while (*link)
+                    {
+                        link = &(*link)->m_links[node->m_key < (*link)->m_key ? 0 : 1];
+                    }
+                    *link = node;
+                }
+                break;
+            case Structure::k_hashTable:
+                linked.m_buckets.resize(nodes.size() / k_nodesPerBucket, nullptr);
+                for (auto node : nodes)
+                {
+                    auto& bucket = linked.m_buckets[GetBucket(node->m_key, linked.m_buckets.size())];
+                    node->m_links[0] = bucket;
+                    bucket = node;
+                }
+                break;
+            default:
+                break;
+            }
+
+            return linked;
+        }
+
+        /// Visits every node of the given structure once, incrementing its value.
+        /// Trees are traversed in key order using the given stack.
+        ///
+        /// @param structure
+        ///        The type of structure.
+        /// @param linked
+        ///        The linked structure.
+        /// @param stack
+        ///        Scratch space for traversing trees, which must be able to hold
+        ///        the depth of the tree without growing.
+        ///
+        /// @return The sum of the values visited, so that the traversal can't be
+        /// optimised away.
+        ///
+        std::uint64_t TraverseAndUpdate(Structure structure, const LinkedStructure& linked, std::vector<Node*>& stack) noexcept
+        {
+            std::uint64_t sum = 0;
+
+            switch (structure)
+            {
+            case Structure::k_list:
+                for (auto node = linked.m_head; node; node = node->m_links[0])
+                {
+                    sum += node->m_value++;
+                }
+                break;
+            case Structure::k_tree:
+            {
+                auto node = linked.m_head;
+                while (node || !stack.empty())
+                {
+                    while (node)
+                    {
+                        stack.push_back(node);
+                        node = node->m_links[0];
+                    }
+
+                    node = stack.back();
+                    stack.pop_back();
+                    sum += node->m_value++;
+                    node = node->m_links[1];
+                }
+                break;
+            }
+            case Structure::k_hashTable:
+                for (auto bucket : linked.m_buckets)
+                {
+                    for (auto node = bucket; node; node = node->m_links[0])
+                    {
+                        sum += node->m_value++;
+                    }
+                }
+                break;
+            default:
+                break;
+            }
+
+            return sum;
+        }
+
+        /// @param linked
+        ///        A linked tree.
+        ///
+        /// @return The depth of the tree.
+        ///
+        std::size_t GetTreeDepth(const LinkedStructure& linked) noexcept
+        {
+            std::size_t maxDepth = 0;
+            std::vector<std::pair<Node*, std::size_t>> pending;
+            if (linked.m_head)
+            {
+                pending.push_back(std::make_pair(linked.m_head, static_cast<std::size_t>(1)));
+            }
+
+            while (!pending.empty())
+            {
+                auto entry = pending.back();
+                pending.pop_back();
+                maxDepth = std::max(maxDepth, entry.second);
+                for (auto child : entry.first->m_links)
+                {
+                    if (child)
+                    {
+                        pending.push_back(std::make_pair(child, entry.second + 1));
+                    }
+                }
+            }
+
+            return maxDepth;
+        }
+
+        /// Allocates the nodes with the timer stopped, optionally churns them,
+        /// links them into the given structure, and then times the calibrated
+        /// number of iterations, each of which traverses the whole structure
+        /// and updates every node.
+        ///
+        /// Churning frees a random half of the nodes and allocates their
+        /// replacements in a different random order, several times over, which
+        /// scrambles the allocator's free lists as a long-running program would.
+        ///
+        /// @param context_
+        ///        The context of the benchmark.
+        /// @param structure
+        ///        The type of structure.
+        /// @param churn
+        ///        Whether or not the nodes should be churned before linking.
+        /// @param allocate
+        ///        A function which allocates a single node.
+        /// @param deallocate
+        ///        A function which frees the given node.
+        ///
+        template <typename TAllocate, typename TDeallocate>
+        void TimeTraversals(IC::BenchmarkContext& context_, Structure structure, bool churn, const TAllocate& allocate, const TDeallocate& deallocate) noexcept
+        {
+            using Pointer = decltype(allocate());
+
+            std::mt19937 random(k_seed);
+
+            std::vector<Pointer> pointers;
+            pointers.reserve(k_numNodes);
+            for (std::uint32_t i = 0; i < k_numNodes; ++i)
+            {
+                pointers.push_back(allocate());
+            }
+
+            std::vector<std::uint32_t> indices(k_numNodes);
+            for (std::uint32_t i = 0; i < k_numNodes; ++i)
+            {
+                indices[i] = i;
+            }
+
+            for (std::uint32_t round = 0; churn && round < k_numChurnRounds; ++round)
+            {
+                Shuffle(random, indices);
+                std::vector<std::uint32_t> freed(indices.begin(), indices.begin() + k_numNodes / 2);
+                for (auto index : freed)
+                {
+                    deallocate(pointers[index]);
+                }
+
+                Shuffle(random, freed);
+                for (auto index : freed)
+                {
+                    pointers[index] = allocate();
+                }
+            }
+
+            Shuffle(random, indices);
+
+            std::vector<Node*> nodes;
+            nodes.reserve(k_numNodes);
+            for (std::uint32_t i = 0; i < k_numNodes; ++i)
+            {
+                auto node = GetNode(pointers[i]);
+                node->m_links[0] = nullptr;
+                node->m_links[1] = nullptr;
+                node->m_key = indices[i];
+                node->m_value = i;
+                nodes.push_back(node);
+            }
+
+            auto linked = LinkNodes(structure, nodes);
+
+            std::vector<Node*> stack;
+            stack.reserve(structure == Structure::k_tree ? GetTreeDepth(linked) : 0);
+
+            IC_STARTTIMER();
+
+            IC_ITERATE()
+            {
+                IC::DoNotOptimise(TraverseAndUpdate(structure, linked, stack));
+            }
+
+            IC_STOPTIMER();
+
+            for (auto& pointer : pointers)
+            {
+                deallocate(pointer);
+            }
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numNodes);
+        }
+
+        /// Times traversals of nodes allocated from the given allocator.
+        ///
+        /// @param context_
+        ///        The context of the benchmark.
+        /// @param structure
+        ///        The type of structure.
+        /// @param churn
+        ///        Whether or not the nodes should be churned before linking.
+        /// @param allocator
+        ///        The allocator.
+        ///
+        void TimeTraversals(IC::BenchmarkContext& context_, Structure structure, bool churn, IC::IAllocator& allocator) noexcept
+        {
+            TimeTraversals(context_, structure, churn, [&]() { return new (allocator.Allocate(sizeof(Node))) Node(); }, [&](Node* node) { allocator.Deallocate(node); });
+        }
+
+        /// Registers the benchmarks for the given structure with every
+        /// allocator, each with and without churn. The LinearAllocator can't
+        /// reuse freed memory so is only registered without churn, and its
+        /// nodes are released all at once when it is destroyed.
+        ///
+        /// @param structure
+        ///        The type of structure.
+        ///
+        void RegisterStructure(Structure structure) noexcept
+        {
+            auto& registry = IC::BenchmarkRegistry::Get();
+            auto structureName = GetName(structure);
+
+            registry.RegisterBenchmark(IC::Benchmark(k_benchmarkGroupName, structureName + "/LinearAllocator", [structure](IC::BenchmarkContext& context) noexcept
+            {
+                IC::LinearAllocator allocator(k_numNodes * sizeof(Node) * 2);
+                TimeTraversals(context, structure, false, [&]() { return new (allocator.Allocate(sizeof(Node))) Node(); }, [](Node*) {});
+            }));
+
+            for (auto churn : { false, true })
+            {
+                auto suffix = churn ? "/churned" : "";
+
+                registry.RegisterBenchmark(IC::Benchmark(k_benchmarkGroupName, structureName + "/StandardAllocator" + suffix, [structure, churn](IC::BenchmarkContext& context) noexcept
+                {
+                    TimeTraversals(context, structure, churn, []() { return new Node(); }, [](Node* node) { delete node; });
+                }));
+
+                registry.RegisterBenchmark(IC::Benchmark(k_benchmarkGroupName, structureName + "/PagedBlockAllocator" + suffix, [structure, churn](IC::BenchmarkContext& context) noexcept
+                {
+                    IC::PagedBlockAllocator allocator(sizeof(Node), k_numBlocksPerPage);
+                    TimeTraversals(context, structure, churn, allocator);
+                }));
+
+                registry.RegisterBenchmark(IC::Benchmark(k_benchmarkGroupName, structureName + "/SmallObjectAllocator" + suffix, [structure, churn](IC::BenchmarkContext& context) noexcept
+                {
+                    IC::SmallObjectAllocator allocator(k_numNodes * sizeof(Node) * 2);
+                    TimeTraversals(context, structure, churn, allocator);
+                }));
+
+                registry.RegisterBenchmark(IC::Benchmark(k_benchmarkGroupName, structureName + "/ObjectPool" + suffix, [structure, churn](IC::BenchmarkContext& context) noexcept
+                {
+                    IC::ObjectPool<Node> pool(k_numNodes);
+                    TimeTraversals(context, structure, churn, [&]() { return pool.Create(); }, [](IC::UniquePtr<Node>& node) { node.reset(); });
+                }));
+            }
+        }
+
+        /// Registers the benchmarks for every structure.
+        ///
+        /// @return Whether or not the benchmarks were registered.
+        ///
+        bool RegisterStructures() noexcept
+        {
+            RegisterStructure(Structure::k_list);
+            RegisterStructure(Structure::k_tree);
+            RegisterStructure(Structure::k_hashTable);
+            return true;
+        }
+
+        const bool k_registered = RegisterStructures();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,305 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "AllocationReplay.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace ICMemoryBenchmark
+{
+    namespace
+    {
+        const std::string k_benchmarkGroupName = "DeallocationOrder";
+
+        constexpr std::size_t k_allocationSize = 64;
+        constexpr std::uint32_t k_seed = 1;
+        const std::uint32_t k_batchSizes[] = { 128, 512 };
+
+        /// The orders in which a batch of allocations can be freed.
+        ///
+        enum class DeallocationOrder
+        {
+            k_lifo,
+            k_fifo,
+            k_random,
+            k_interleaved
+        };
+
+        /// The allocation records for a batch, split into the untimed allocation
+        /// phase and the two halves of the timed deallocation phase.
+        ///
+        struct BatchRecords final
+        {
+            std::vector<IC::AllocationTraceRecord> m_allocations;
+            std::vector<IC::AllocationTraceRecord> m_firstDeallocations;
+            std::vector<IC::AllocationTraceRecord> m_secondDeallocations;
+        };
+
+        /// @param order
+        ///        The deallocation order.
+        ///
+        /// @return The name of the order, as used in benchmark names.
+        ///
+        std::string GetName(DeallocationOrder order) noexcept
+        {
+            switch (order)
+            {
+            case DeallocationOrder::k_lifo:
+                return "LIFO";
+            case DeallocationOrder::k_fifo:
+                return "FIFO";
+            case DeallocationOrder::k_random:
+                return "Random";
+            case DeallocationOrder::k_interleaved:
+                return "Interleaved";
+            default:
+                return "Unknown";
+            }
+        }
+
+        /// @param event
+        ///        The event.
+        /// @param slot
+        ///        The slot the event applies to.
+        /// @param timestamp
+        ///        The position of the record in the sequence.
+        ///
+        /// @return A record describing an event on a k_allocationSize allocation.
+        ///
+        IC::AllocationTraceRecord CreateRecord(IC::AllocationTraceEvent event, std::uint32_t slot, std::uint64_t timestamp) noexcept
+        {
+            IC::AllocationTraceRecord record;
+            record.m_timestamp = timestamp;
+            record.m_size = k_allocationSize;
+            record.m_slot = slot;
+            record.m_thread = 0;
+            record.m_alignmentLog2 = 0;
+            record.m_event = static_cast<std::uint8_t>(event);
+            return record;
+        }
+
+        /// Creates the records which allocate a batch in address order and then
+        /// free it in the given order. Interleaved frees every other allocation
+        /// and then the rest, so the first half leaves the most isolated holes.
+        ///
+        /// @param order
+        ///        The deallocation order.
+        /// @param batchSize
+        ///        The number of allocations in the batch.
+        ///
+        /// @return The records.
+        ///
+        BatchRecords CreateBatchRecords(DeallocationOrder order, std::uint32_t batchSize) noexcept
+        {
+            std::vector<std::uint32_t> freeOrder(batchSize);
+            for (std::uint32_t i = 0; i < batchSize; ++i)
+            {
+                freeOrder[i] = i;
+            }
+
+            switch (order)
+            {
+            case DeallocationOrder::k_lifo:
+                std::reverse(freeOrder.begin(), freeOrder.end());
+                break;
+            case DeallocationOrder::k_fifo:
+                break;
+            case DeallocationOrder::k_random:
+            {
+                std::mt19937 random(k_seed);
+                for (std::uint32_t i = batchSize; i > 1; --i)
+                {
+                    std::swap(freeOrder[i - 1], freeOrder[random() % i]);
+                }
+                break;
+            }
+            case DeallocationOrder::k_interleaved:
+                std::stable_partition(freeOrder.begin(), freeOrder.end(), [](std::uint32_t slot) noexcept { return slot % 2 == 0; });
+                break;
+            default:
+                break;
+            }
+
+            BatchRecords records;
+            std::uint64_t timestamp = 0;
+            for (std::uint32_t i = 0; i < batchSize; ++i)
+            {
+                records.m_allocations.push_back(CreateRecord(IC::AllocationTraceEvent::k_allocate, i, timestamp++));
+            }
+
+            for (std::uint32_t i = 0; i < batchSize; ++i)
+            {
+                auto& deallocations = (i < batchSize / 2) ? records.m_firstDeallocations : records.m_secondDeallocations;
+                deallocations.push_back(CreateRecord(IC::AllocationTraceEvent::k_deallocate, freeOrder[i], timestamp++));
+            }
+
+            return records;
+        }
+
+        /// Estimates the fragmentation of the address range spanned by the
+        /// allocations which are still live, as one minus the size of the
+        /// largest free gap between them over the total free space in the range.
+        /// ICMemory doesn't expose the state of its allocators, so this models
+        /// fragmentation from the addresses alone. This is only meaningful for
+        /// the BuddyAllocator, whose blocks are laid out contiguously: for the
+        /// others it would count headers, padding and unrelated memory as free
+        /// space.
+        ///
+        /// @param slots
+        ///        The allocations. Those which fell back to malloc() are ignored.
+        ///
+        /// @return The fragmentation in the range [0, 1], where zero means the
+        /// free space is one contiguous gap.
+        ///
+        double CalcFragmentation(const std::vector<ReplaySlot>& slots) noexcept
+        {
+            std::vector<std::uintptr_t> addresses;
+            for (const auto& slot : slots)
+            {
+                if (slot.m_pointer && !slot.m_fallback)
+                {
+                    addresses.push_back(reinterpret_cast<std::uintptr_t>(slot.m_pointer));
+                }
+            }
+
+            if (addresses.size() < 2)
+            {
+                return 0.0;
+            }
+
+            std::sort(addresses.begin(), addresses.end());
+
+            std::uintptr_t freeBytes = 0;
+            std::uintptr_t largestGap = 0;
+            for (std::size_t i = 1; i < addresses.size(); ++i)
+            {
+                auto gap = addresses[i] - std::min(addresses[i - 1] + k_allocationSize, addresses[i]);
+                freeBytes += gap;
+                largestGap = std::max(largestGap, gap);
+            }
+
+            if (freeBytes == 0)
+            {
+                return 0.0;
+            }
+
+            return 1.0 - static_cast<double>(largestGap) / static_cast<double>(freeBytes);
+        }
+
+        /// Times the calibrated number of iterations, each of which allocates
+        /// the batch with the timer paused and then frees it in order with the
+        /// timer running. If requested, the fragmentation is measured, untimed,
+        /// once half of the batch has been freed and reported as the
+        /// "fragmentation" counter. The number of allocations per batch which
+        /// fell back to malloc() is reported as the "fallbackAllocations"
+        /// counter.
+        ///
+        /// @param context_
+        ///        The context of the benchmark.
+        /// @param allocator
+        ///        The allocator to benchmark.
+        /// @param records
+        ///        The batch records.
+        /// @param measureFragmentation
+        ///        Whether or not to measure the fragmentation. This should only
+        ///        be set for the BuddyAllocator.
+        ///
+        void FreeBatch(IC::BenchmarkContext& context_, IC::IAllocator& allocator, const BatchRecords& records, bool measureFragmentation) noexcept
+        {
+            auto batchSize = records.m_allocations.size();
+            std::vector<ReplaySlot> slots(batchSize);
+            double totalFragmentation = 0.0;
+            std::uint64_t numFallbacks = 0;
+
+            IC_STARTTIMER();
+
+            IC_ITERATE()
+            {
+                IC_PAUSETIMER();
+                numFallbacks += ReplayRecords(context_, allocator, records.m_allocations.data(), records.m_allocations.size(), slots).m_numFallbacks;
+                IC_RESUMETIMER();
+
+                ReplayRecords(context_, allocator, records.m_firstDeallocations.data(), records.m_firstDeallocations.size(), slots);
+
+                if (measureFragmentation)
+                {
+                    IC_PAUSETIMER();
+                    totalFragmentation += CalcFragmentation(slots);
+                    IC_RESUMETIMER();
+                }
+
+                ReplayRecords(context_, allocator, records.m_secondDeallocations.data(), records.m_secondDeallocations.size(), slots);
+            }
+
+            IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * batchSize);
+            IC_SETNUMALLOCATEDBYTES(IC_NUMITERATIONS() * batchSize * k_allocationSize);
+            if (measureFragmentation)
+            {
+                IC_SETCOUNTER("fragmentation", totalFragmentation / static_cast<double>(IC_NUMITERATIONS()));
+            }
+            IC_SETCOUNTER("fallbackAllocations", static_cast<double>(numFallbacks) / static_cast<double>(IC_NUMITERATIONS()));
+        }
+
+        /// Registers a benchmark which frees batches of each size in the given
+        /// order, against each allocator.
+        ///
+        /// @param order
+        ///        The deallocation order.
+        ///
+        void RegisterOrder(DeallocationOrder order) noexcept
+        {
+            for (auto batchSize : k_batchSizes)
+            {
+                auto records = std::make_shared<const BatchRecords>(CreateBatchRecords(order, batchSize));
+                auto namePrefix = GetName(order) + "/batch:" + std::to_string(batchSize) + "/";
+                ReplayRequirements requirements;
+                requirements.m_maxAllocationSize = k_allocationSize;
+                requirements.m_peakLiveBytes = batchSize * k_allocationSize;
+
+                RegisterAllocatorBenchmarks(k_benchmarkGroupName, namePrefix, requirements, [records](IC::BenchmarkContext& context, IC::IAllocator& allocator, ReplayAllocator allocatorType) noexcept
+                {
+                    FreeBatch(context, allocator, *records, allocatorType == ReplayAllocator::k_buddy);
+                });
+            }
+        }
+
+        /// Registers the benchmarks for every deallocation order.
+        ///
+        /// @return Whether or not the benchmarks were registered.
+        ///
+        bool RegisterOrders() noexcept
+        {
+            RegisterOrder(DeallocationOrder::k_lifo);
+            RegisterOrder(DeallocationOrder::k_fifo);
+            RegisterOrder(DeallocationOrder::k_random);
+            RegisterOrder(DeallocationOrder::k_interleaved);
+            return true;
+        }
+
+        const bool k_registered = RegisterOrders();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,161 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICMEMORYBENCHMARK_LINEARALLOCATORFIXTURES_H_
+#define _ICMEMORYBENCHMARK_LINEARALLOCATORFIXTURES_H_
+
+#include "../ICBenchmark/ICBenchmark.h"
+#include "../ICBenchmark/Timer.h"
+#include "../ICMemory/ICMemory.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ICMemoryBenchmark
+{
+    /// Fixtures shared by the small, medium and large allocation benchmarks for
+    /// measuring linear allocators. Each benchmark group declares aliases which
+    /// bind its own page and allocation sizes.
+    ///
+    namespace LinearAllocatorFixtures
+    {
+        /// Calculates the space an allocation of the given size occupies in a
+        /// linear allocator, assuming allocations are aligned to at most
+        /// alignof(std::max_align_t).
+        ///
+        /// @param allocationSize
+        ///        The size of the allocation in bytes.
+        ///
+        /// @return The size of the allocation rounded up to the alignment.
+        ///
+        constexpr std::size_t GetAlignedSize(std::size_t allocationSize) noexcept
+        {
+            return (allocationSize + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+        }
+
+        /// A fixture which owns a linear allocator of the given type and page size.
+        /// The allocator is reset with the timer paused whenever the next iteration
+        /// could exhaust the page, so only the allocations themselves are measured
+        /// and the cost of pausing the timer is spread over as many iterations as
+        /// the page can hold.
+        ///
+        /// The number of bytes per iteration must include alignment padding; see
+        /// GetAlignedSize().
+        ///
+        template <typename TAllocator, std::size_t TPageSize, std::size_t TBytesPerIteration> class LinearAllocatorFixture : public IC::BenchmarkFixture
+        {
+        public:
+            LinearAllocatorFixture() noexcept
+            {
+                SetIterationInterval(std::max<std::uint64_t>(1, TPageSize / TBytesPerIteration));
+            }
+
+            void TearDownIteration() noexcept override
+            {
+                m_allocator.Reset();
+            }
+
+        protected:
+            TAllocator m_allocator{TPageSize};
+        };
+
+        /// A fixture for measuring the cost of resetting a linear allocator of the
+        /// given type and page size after it has been filled with the given number
+        /// of allocations, which are all freed again before the reset.
+        ///
+        /// A reset is too cheap to measure between two pauses of the timer, so
+        /// each iteration fills and resets the allocator within one timer window,
+        /// and the time taken by the fills alone is measured separately and
+        /// excluded.
+        ///
+        template <typename TAllocator, std::size_t TPageSize, std::size_t TAllocationSize, std::size_t TNumAllocations>
+        class LinearAllocatorResetFixture : public IC::BenchmarkFixture
+        {
+        protected:
+            /// Times the calibrated number of resets. The iterations are performed
+            /// in batches of as many fills as the page can hold: before each
+            /// batch, with the timer paused, the same number of fills are timed
+            /// without resets, so both are measured with the same number of clock
+            /// reads and in the same cache state.
+            ///
+            /// @param context_
+            ///        The context of the benchmark.
+            ///
+            void TimeResets(IC::BenchmarkContext& context_) noexcept
+            {
+                constexpr std::uint64_t k_numFillsPerBatch = std::max<std::uint64_t>(1, TPageSize / (TNumAllocations * GetAlignedSize(TAllocationSize)));
+
+                auto numIterations = IC_NUMITERATIONS();
+                std::uint64_t fillTime = 0;
+
+                IC_STARTTIMER();
+
+                for (std::uint64_t i = 0; i < numIterations; i += k_numFillsPerBatch)
+                {
+                    auto batchSize = std::min(k_numFillsPerBatch, numIterations - i);
+
+                    IC_PAUSETIMER();
+
+                    IC::Timer fillTimer;
+                    for (std::uint64_t j = 0; j < batchSize; ++j)
+                    {
+                        Fill();
+                    }
+                    fillTimer.Stop();
+                    fillTime += fillTimer.GetElapsedTime();
+                    m_allocator.Reset();
+
+                    IC_RESUMETIMER();
+
+                    for (std::uint64_t j = 0; j < batchSize; ++j)
+                    {
+                        Fill();
+                        m_allocator.Reset();
+                    }
+                }
+
+                IC_STOPTIMER();
+
+                IC_EXCLUDETIME(fillTime);
+                IC_SETNUMOPERATIONS(numIterations);
+            }
+
+        private:
+            /// Makes the given number of allocations and frees them again.
+            ///
+            void Fill() noexcept
+            {
+                std::array<IC::UniquePtr<std::uint8_t[]>, TNumAllocations> allocations;
+                for (auto& allocation : allocations)
+                {
+                    allocation = IC::MakeUniqueArray<std::uint8_t>(m_allocator, TAllocationSize);
+                }
+            }
+
+            TAllocator m_allocator{TPageSize};
+        };
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,52 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "LockingAllocator.h"
+
+namespace ICMemoryBenchmark
+{
+    //------------------------------------------------------------------------------
+    LockingAllocator::LockingAllocator(IC::IAllocator& allocator) noexcept
+        : m_allocator(allocator)
+    {
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t LockingAllocator::GetMaxAllocationSize() const noexcept
+    {
+        return m_allocator.GetMaxAllocationSize();
+    }
+
+    //------------------------------------------------------------------------------
+    void* LockingAllocator::Allocate(std::size_t allocationSize) noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_allocator.Allocate(allocationSize);
+    }
+
+    //------------------------------------------------------------------------------
+    void LockingAllocator::Deallocate(void* pointer) noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_allocator.Deallocate(pointer);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICMEMORYBENCHMARK_LOCKINGALLOCATOR_H_
+#define _ICMEMORYBENCHMARK_LOCKINGALLOCATOR_H_
+
+#include "../ICMemory/ICMemory.h"
+
+#include <mutex>
+
+namespace ICMemoryBenchmark
+{
+    /// An allocator which forwards to another, serialising every call through
+    /// a mutex. This allows allocators which aren't thread-safe to be used
+    /// from several threads, for example to allocate on one thread and free on
+    /// another. The cost of the lock is part of what is measured.
+    ///
+    /// This is thread-safe.
+    ///
+    class LockingAllocator final : public IC::IAllocator
+    {
+    public:
+        /// @param allocator
+        ///        The allocator to forward to. This must outlive the locking
+        ///        allocator.
+        ///
+        LockingAllocator(IC::IAllocator& allocator) noexcept;
+
+        std::size_t GetMaxAllocationSize() const noexcept override;
+
+        void* Allocate(std::size_t allocationSize) noexcept override;
+
+        void Deallocate(void* pointer) noexcept override;
+
+    private:
+        LockingAllocator(const LockingAllocator&) = delete;
+        LockingAllocator& operator=(const LockingAllocator&) = delete;
+
+        IC::IAllocator& m_allocator;
+        std::mutex m_mutex;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -22,15 +22,20 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
-#include "../ICBenchmark/ICBenchmark.h"
-#include "../ICMemory/ICMemory.h"
+#include "LinearAllocatorFixtures.h"
 
 namespace ICMemoryBenchmark
 {
     namespace
     {
-        constexpr std::int32_t k_numIterations = 500000;
+        constexpr std::int32_t k_numAllocationsPerIteration = 5;
+        constexpr std::size_t k_linearPageSize = 1024 * 1024;
         constexpr std::int32_t k_allocationSize = 8 * 1024;
+
+        template <typename TAllocator> using LinearAllocatorFixture = LinearAllocatorFixtures::LinearAllocatorFixture<TAllocator, k_linearPageSize,
+            k_numAllocationsPerIteration * LinearAllocatorFixtures::GetAlignedSize(k_allocationSize)>;
+        template <typename TAllocator> using LinearAllocatorResetFixture
+            = LinearAllocatorFixtures::LinearAllocatorResetFixture<TAllocator, k_linearPageSize, k_allocationSize, k_numAllocationsPerIteration>;
     }
 
     /// A benchmark for measuring the time taken to perform a large number of medium 
@@ -44,16 +49,31 @@ namespace ICMemoryBenchmark
         {
             IC_STARTTIMER();
 
-            for (int i = 0; i < k_numIterations; ++i)
+            IC_ITERATE()
             {
-                auto a = std::unique_ptr<std::uint8_t[]>(new uint8_t[k_allocationSize]);
-                auto b = std::unique_ptr<std::uint8_t[]>(new uint8_t[k_allocationSize]);
-                auto c = std::unique_ptr<std::uint8_t[]>(new uint8_t[k_allocationSize]);
-                auto d = std::unique_ptr<std::uint8_t[]>(new uint8_t[k_allocationSize]);
-                auto e = std::unique_ptr<std::uint8_t[]>(new uint8_t[k_allocationSize]);
+                auto a = IC_TIMEALLOCATION(std::unique_ptr<std::uint8_t[]>(new uint8_t[k_allocationSize]));
+                auto b = IC_TIMEALLOCATION(std::unique_ptr<std::uint8_t[]>(new uint8_t[k_allocationSize]));
+                auto c = IC_TIMEALLOCATION(std::unique_ptr<std::uint8_t[]>(new uint8_t[k_allocationSize]));
+                auto d = IC_TIMEALLOCATION(std::unique_ptr<std::uint8_t[]>(new uint8_t[k_allocationSize]));
+                auto e = IC_TIMEALLOCATION(std::unique_ptr<std::uint8_t[]>(new uint8_t[k_allocationSize]));
+
+                IC::TouchMemory(a.get(), k_allocationSize);
+                IC::TouchMemory(b.get(), k_allocationSize);
+                IC::TouchMemory(c.get(), k_allocationSize);
+                IC::TouchMemory(d.get(), k_allocationSize);
+                IC::TouchMemory(e.get(), k_allocationSize);
+
+                IC_TIMEDEALLOCATION(e.reset());
+                IC_TIMEDEALLOCATION(d.reset());
+                IC_TIMEDEALLOCATION(c.reset());
+                IC_TIMEDEALLOCATION(b.reset());
+                IC_TIMEDEALLOCATION(a.reset());
             }
 
             IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numAllocationsPerIteration);
+            IC_SETNUMALLOCATEDBYTES(IC_NUMITERATIONS() * k_numAllocationsPerIteration * k_allocationSize);
         }
 
         /// Performs the benchmark with a BuddyAllocator.
@@ -66,68 +86,111 @@ namespace ICMemoryBenchmark
 
             IC_STARTTIMER();
 
-            for (int i = 0; i < k_numIterations; ++i)
+            IC_ITERATE()
             {
-                auto a = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                auto b = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                auto c = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                auto d = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                auto e = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
+                auto a = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize));
+                auto b = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize));
+                auto c = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize));
+                auto d = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize));
+                auto e = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize));
+
+                IC::TouchMemory(a.get(), k_allocationSize);
+                IC::TouchMemory(b.get(), k_allocationSize);
+                IC::TouchMemory(c.get(), k_allocationSize);
+                IC::TouchMemory(d.get(), k_allocationSize);
+                IC::TouchMemory(e.get(), k_allocationSize);
+
+                IC_TIMEDEALLOCATION(e.reset());
+                IC_TIMEDEALLOCATION(d.reset());
+                IC_TIMEDEALLOCATION(c.reset());
+                IC_TIMEDEALLOCATION(b.reset());
+                IC_TIMEDEALLOCATION(a.reset());
             }
 
             IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numAllocationsPerIteration);
+            IC_SETNUMALLOCATEDBYTES(IC_NUMITERATIONS() * k_numAllocationsPerIteration * k_allocationSize);
         }
 
         /// Performs the benchmark with a LinearAllocator.
         ///
-        IC_BENCHMARK(LinearAllocator)
+        IC_FIXTUREBENCHMARK(LinearAllocatorFixture<IC::LinearAllocator>, LinearAllocator)
         {
-            constexpr std::size_t k_pageSize = 64 * 1024;
-
-            IC::LinearAllocator allocator(k_pageSize);
-
             IC_STARTTIMER();
 
-            for (int i = 0; i < k_numIterations; ++i)
+            IC_ITERATE()
             {
-                {
-                    auto a = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                    auto b = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                    auto c = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                    auto d = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                    auto e = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                }
-
-                allocator.Reset();
+                auto a = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(m_allocator, k_allocationSize));
+                auto b = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(m_allocator, k_allocationSize));
+                auto c = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(m_allocator, k_allocationSize));
+                auto d = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(m_allocator, k_allocationSize));
+                auto e = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(m_allocator, k_allocationSize));
+
+                IC::TouchMemory(a.get(), k_allocationSize);
+                IC::TouchMemory(b.get(), k_allocationSize);
+                IC::TouchMemory(c.get(), k_allocationSize);
+                IC::TouchMemory(d.get(), k_allocationSize);
+                IC::TouchMemory(e.get(), k_allocationSize);
+
+                IC_TIMEDEALLOCATION(e.reset());
+                IC_TIMEDEALLOCATION(d.reset());
+                IC_TIMEDEALLOCATION(c.reset());
+                IC_TIMEDEALLOCATION(b.reset());
+                IC_TIMEDEALLOCATION(a.reset());
             }
 
             IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numAllocationsPerIteration);
+            IC_SETNUMALLOCATEDBYTES(IC_NUMITERATIONS() * k_numAllocationsPerIteration * k_allocationSize);
         }
 
-        /// Performs the benchmark with a PagedLinearAllocator.
+        /// Measures the cost of resetting a LinearAllocator after five allocations have been made and freed.
         ///
-        IC_BENCHMARK(PagedLinearAllocator)
+        IC_FIXTUREBENCHMARK(LinearAllocatorResetFixture<IC::LinearAllocator>, LinearAllocatorReset)
         {
-            constexpr std::size_t k_pageSize = 64 * 1024;
-
-            IC::PagedLinearAllocator allocator(k_pageSize);
+            TimeResets(context_);
+        }
 
+        /// Performs the benchmark with a PagedLinearAllocator.
+        ///
+        IC_FIXTUREBENCHMARK(LinearAllocatorFixture<IC::PagedLinearAllocator>, PagedLinearAllocator)
+        {
             IC_STARTTIMER();
 
-            for (int i = 0; i < k_numIterations; ++i)
+            IC_ITERATE()
             {
-                {
-                    auto a = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                    auto b = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                    auto c = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                    auto d = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                    auto e = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                }
-
-                allocator.Reset();
+                auto a = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(m_allocator, k_allocationSize));
+                auto b = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(m_allocator, k_allocationSize));
+                auto c = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(m_allocator, k_allocationSize));
+                auto d = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(m_allocator, k_allocationSize));
+                auto e = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(m_allocator, k_allocationSize));
+
+                IC::TouchMemory(a.get(), k_allocationSize);
+                IC::TouchMemory(b.get(), k_allocationSize);
+                IC::TouchMemory(c.get(), k_allocationSize);
+                IC::TouchMemory(d.get(), k_allocationSize);
+                IC::TouchMemory(e.get(), k_allocationSize);
+
+                IC_TIMEDEALLOCATION(e.reset());
+                IC_TIMEDEALLOCATION(d.reset());
+                IC_TIMEDEALLOCATION(c.reset());
+                IC_TIMEDEALLOCATION(b.reset());
+                IC_TIMEDEALLOCATION(a.reset());
             }
 
             IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numAllocationsPerIteration);
+            IC_SETNUMALLOCATEDBYTES(IC_NUMITERATIONS() * k_numAllocationsPerIteration * k_allocationSize);
+        }
+
+        /// Measures the cost of resetting a PagedLinearAllocator after five allocations have been made and freed.
+        ///
+        IC_FIXTUREBENCHMARK(LinearAllocatorResetFixture<IC::PagedLinearAllocator>, PagedLinearAllocatorReset)
+        {
+            TimeResets(context_);
         }
 
 
@@ -141,16 +204,31 @@ namespace ICMemoryBenchmark
 
             IC_STARTTIMER();
 
-            for (int i = 0; i < k_numIterations; ++i)
+            IC_ITERATE()
             {
-                auto a = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                auto b = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                auto c = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                auto d = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                auto e = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
+                auto a = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize));
+                auto b = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize));
+                auto c = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize));
+                auto d = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize));
+                auto e = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize));
+
+                IC::TouchMemory(a.get(), k_allocationSize);
+                IC::TouchMemory(b.get(), k_allocationSize);
+                IC::TouchMemory(c.get(), k_allocationSize);
+                IC::TouchMemory(d.get(), k_allocationSize);
+                IC::TouchMemory(e.get(), k_allocationSize);
+
+                IC_TIMEDEALLOCATION(e.reset());
+                IC_TIMEDEALLOCATION(d.reset());
+                IC_TIMEDEALLOCATION(c.reset());
+                IC_TIMEDEALLOCATION(b.reset());
+                IC_TIMEDEALLOCATION(a.reset());
             }
 
             IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numAllocationsPerIteration);
+            IC_SETNUMALLOCATEDBYTES(IC_NUMITERATIONS() * k_numAllocationsPerIteration * k_allocationSize);
         }
 
         /// Performs the benchmark with a PagedBlockAllocator.
@@ -163,16 +241,31 @@ namespace ICMemoryBenchmark
 
             IC_STARTTIMER();
 
-            for (int i = 0; i < k_numIterations; ++i)
+            IC_ITERATE()
             {
-                auto a = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                auto b = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                auto c = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                auto d = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
-                auto e = IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize);
+                auto a = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize));
+                auto b = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize));
+                auto c = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize));
+                auto d = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize));
+                auto e = IC_TIMEALLOCATION(IC::MakeUniqueArray<std::uint8_t>(allocator, k_allocationSize));
+
+                IC::TouchMemory(a.get(), k_allocationSize);
+                IC::TouchMemory(b.get(), k_allocationSize);
+                IC::TouchMemory(c.get(), k_allocationSize);
+                IC::TouchMemory(d.get(), k_allocationSize);
+                IC::TouchMemory(e.get(), k_allocationSize);
+
+                IC_TIMEDEALLOCATION(e.reset());
+                IC_TIMEDEALLOCATION(d.reset());
+                IC_TIMEDEALLOCATION(c.reset());
+                IC_TIMEDEALLOCATION(b.reset());
+                IC_TIMEDEALLOCATION(a.reset());
             }
 
             IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numAllocationsPerIteration);
+            IC_SETNUMALLOCATEDBYTES(IC_NUMITERATIONS() * k_numAllocationsPerIteration * k_allocationSize);
         }
     }
 }
\ No newline at end of file
@@ -22,14 +22,14 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
-#include "../ICBenchmark/ICBenchmark.h"
-#include "../ICMemory/ICMemory.h"
+#include "LinearAllocatorFixtures.h"
 
 namespace ICMemoryBenchmark
 {
     namespace
     {
-        constexpr std::int32_t k_numIterations = 1000000;
+        constexpr std::int32_t k_numAllocationsPerIteration = 3;
+        constexpr std::size_t k_linearPageSize = 4 * 1024;
 
         /// A small example struct.
         ///
@@ -40,6 +40,14 @@ namespace ICMemoryBenchmark
             std::uint32_t m_c;
             std::uint64_t m_d;
         };
+
+        constexpr std::size_t k_numBytesPerIteration = sizeof(std::uint32_t) + sizeof(std::uint64_t) + sizeof(SmallStruct);
+        constexpr std::size_t k_numLinearBytesPerIteration = LinearAllocatorFixtures::GetAlignedSize(sizeof(std::uint32_t)) + LinearAllocatorFixtures::GetAlignedSize(sizeof(std::uint64_t))
+            + LinearAllocatorFixtures::GetAlignedSize(sizeof(SmallStruct));
+
+        template <typename TAllocator> using LinearAllocatorFixture = LinearAllocatorFixtures::LinearAllocatorFixture<TAllocator, k_linearPageSize, k_numLinearBytesPerIteration>;
+        template <typename TAllocator> using LinearAllocatorResetFixture
+            = LinearAllocatorFixtures::LinearAllocatorResetFixture<TAllocator, k_linearPageSize, sizeof(SmallStruct), k_numAllocationsPerIteration>;
     }
 
     /// A benchmark for measuring the time taken to perform a large number of small 
@@ -53,14 +61,25 @@ namespace ICMemoryBenchmark
         {
             IC_STARTTIMER();
 
-            for (int i = 0; i < k_numIterations; ++i)
+            IC_ITERATE()
             {
-                auto a = std::unique_ptr<std::uint32_t>(new uint32_t);
-                auto b = std::unique_ptr<std::uint64_t>(new uint64_t);
-                auto c = std::unique_ptr<SmallStruct>(new SmallStruct());
+                auto a = IC_TIMEALLOCATION(std::unique_ptr<std::uint32_t>(new uint32_t));
+                auto b = IC_TIMEALLOCATION(std::unique_ptr<std::uint64_t>(new uint64_t));
+                auto c = IC_TIMEALLOCATION(std::unique_ptr<SmallStruct>(new SmallStruct()));
+
+                IC::TouchMemory(a.get(), sizeof(*a));
+                IC::TouchMemory(b.get(), sizeof(*b));
+                IC::TouchMemory(c.get(), sizeof(*c));
+
+                IC_TIMEDEALLOCATION(c.reset());
+                IC_TIMEDEALLOCATION(b.reset());
+                IC_TIMEDEALLOCATION(a.reset());
             }
 
             IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numAllocationsPerIteration);
+            IC_SETNUMALLOCATEDBYTES(IC_NUMITERATIONS() * k_numBytesPerIteration);
         }
 
         /// Performs the benchmark with a BuddyAllocator.
@@ -73,62 +92,93 @@ namespace ICMemoryBenchmark
 
             IC_STARTTIMER();
 
-            for (int i = 0; i < k_numIterations; ++i)
+            IC_ITERATE()
             {
-                auto a = IC::MakeUnique<std::uint32_t>(allocator);
-                auto b = IC::MakeUnique<std::uint64_t>(allocator);
-                auto c = IC::MakeUnique<SmallStruct>(allocator);
+                auto a = IC_TIMEALLOCATION(IC::MakeUnique<std::uint32_t>(allocator));
+                auto b = IC_TIMEALLOCATION(IC::MakeUnique<std::uint64_t>(allocator));
+                auto c = IC_TIMEALLOCATION(IC::MakeUnique<SmallStruct>(allocator));
+
+                IC::TouchMemory(a.get(), sizeof(*a));
+                IC::TouchMemory(b.get(), sizeof(*b));
+                IC::TouchMemory(c.get(), sizeof(*c));
+
+                IC_TIMEDEALLOCATION(c.reset());
+                IC_TIMEDEALLOCATION(b.reset());
+                IC_TIMEDEALLOCATION(a.reset());
             }
 
             IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numAllocationsPerIteration);
+            IC_SETNUMALLOCATEDBYTES(IC_NUMITERATIONS() * k_numBytesPerIteration);
         }
 
         /// Performs the benchmark with a LinearAllocator.
         ///
-        IC_BENCHMARK(LinearAllocator)
+        IC_FIXTUREBENCHMARK(LinearAllocatorFixture<IC::LinearAllocator>, LinearAllocator)
         {
-            constexpr std::size_t k_allocatorSize = 4 * 1024;
-
-            IC::LinearAllocator allocator(k_allocatorSize);
-
             IC_STARTTIMER();
 
-            for (int i = 0; i < k_numIterations; ++i)
+            IC_ITERATE()
             {
-                {
-                    auto a = IC::MakeUnique<std::uint32_t>(allocator);
-                    auto b = IC::MakeUnique<std::uint64_t>(allocator);
-                    auto c = IC::MakeUnique<SmallStruct>(allocator);
-                }
+                auto a = IC_TIMEALLOCATION(IC::MakeUnique<std::uint32_t>(m_allocator));
+                auto b = IC_TIMEALLOCATION(IC::MakeUnique<std::uint64_t>(m_allocator));
+                auto c = IC_TIMEALLOCATION(IC::MakeUnique<SmallStruct>(m_allocator));
 
-                allocator.Reset();
+                IC::TouchMemory(a.get(), sizeof(*a));
+                IC::TouchMemory(b.get(), sizeof(*b));
+                IC::TouchMemory(c.get(), sizeof(*c));
+
+                IC_TIMEDEALLOCATION(c.reset());
+                IC_TIMEDEALLOCATION(b.reset());
+                IC_TIMEDEALLOCATION(a.reset());
             }
 
             IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numAllocationsPerIteration);
+            IC_SETNUMALLOCATEDBYTES(IC_NUMITERATIONS() * k_numBytesPerIteration);
         }
 
-        /// Performs the benchmark with a PagedLinearAllocator.
+        /// Measures the cost of resetting a LinearAllocator after three small allocations have been made and freed.
         ///
-        IC_BENCHMARK(PagedLinearAllocator)
+        IC_FIXTUREBENCHMARK(LinearAllocatorResetFixture<IC::LinearAllocator>, LinearAllocatorReset)
         {
-            constexpr std::size_t k_allocatorSize = 4 * 1024;
-
-            IC::PagedLinearAllocator allocator(k_allocatorSize);
+            TimeResets(context_);
+        }
 
+        /// Performs the benchmark with a PagedLinearAllocator.
+        ///
+        IC_FIXTUREBENCHMARK(LinearAllocatorFixture<IC::PagedLinearAllocator>, PagedLinearAllocator)
+        {
             IC_STARTTIMER();
 
-            for (int i = 0; i < k_numIterations; ++i)
+            IC_ITERATE()
             {
-                {
-                    auto a = IC::MakeUnique<std::uint32_t>(allocator);
-                    auto b = IC::MakeUnique<std::uint64_t>(allocator);
-                    auto c = IC::MakeUnique<SmallStruct>(allocator);
-                }
+                auto a = IC_TIMEALLOCATION(IC::MakeUnique<std::uint32_t>(m_allocator));
+                auto b = IC_TIMEALLOCATION(IC::MakeUnique<std::uint64_t>(m_allocator));
+                auto c = IC_TIMEALLOCATION(IC::MakeUnique<SmallStruct>(m_allocator));
+
+                IC::TouchMemory(a.get(), sizeof(*a));
+                IC::TouchMemory(b.get(), sizeof(*b));
+                IC::TouchMemory(c.get(), sizeof(*c));
 
-                allocator.Reset();
+                IC_TIMEDEALLOCATION(c.reset());
+                IC_TIMEDEALLOCATION(b.reset());
+                IC_TIMEDEALLOCATION(a.reset());
             }
 
             IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numAllocationsPerIteration);
+            IC_SETNUMALLOCATEDBYTES(IC_NUMITERATIONS() * k_numBytesPerIteration);
+        }
+
+        /// Measures the cost of resetting a PagedLinearAllocator after three small allocations have been made and freed.
+        ///
+        IC_FIXTUREBENCHMARK(LinearAllocatorResetFixture<IC::PagedLinearAllocator>, PagedLinearAllocatorReset)
+        {
+            TimeResets(context_);
         }
 
         /// Performs the benchmark with a BlockAllocator
@@ -142,14 +192,25 @@ namespace ICMemoryBenchmark
 
             IC_STARTTIMER();
 
-            for (int i = 0; i < k_numIterations; ++i)
+            IC_ITERATE()
             {
-                auto a = IC::MakeUnique<std::uint32_t>(allocator);
-                auto b = IC::MakeUnique<std::uint64_t>(allocator);
-                auto c = IC::MakeUnique<SmallStruct>(allocator);
+                auto a = IC_TIMEALLOCATION(IC::MakeUnique<std::uint32_t>(allocator));
+                auto b = IC_TIMEALLOCATION(IC::MakeUnique<std::uint64_t>(allocator));
+                auto c = IC_TIMEALLOCATION(IC::MakeUnique<SmallStruct>(allocator));
+
+                IC::TouchMemory(a.get(), sizeof(*a));
+                IC::TouchMemory(b.get(), sizeof(*b));
+                IC::TouchMemory(c.get(), sizeof(*c));
+
+                IC_TIMEDEALLOCATION(c.reset());
+                IC_TIMEDEALLOCATION(b.reset());
+                IC_TIMEDEALLOCATION(a.reset());
             }
 
             IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numAllocationsPerIteration);
+            IC_SETNUMALLOCATEDBYTES(IC_NUMITERATIONS() * k_numBytesPerIteration);
         }
 
         /// Performs the benchmark with a PagedBlockAllocator
@@ -163,14 +224,25 @@ namespace ICMemoryBenchmark
 
             IC_STARTTIMER();
 
-            for (int i = 0; i < k_numIterations; ++i)
+            IC_ITERATE()
             {
-                auto a = IC::MakeUnique<std::uint32_t>(allocator);
-                auto b = IC::MakeUnique<std::uint64_t>(allocator);
-                auto c = IC::MakeUnique<SmallStruct>(allocator);
+                auto a = IC_TIMEALLOCATION(IC::MakeUnique<std::uint32_t>(allocator));
+                auto b = IC_TIMEALLOCATION(IC::MakeUnique<std::uint64_t>(allocator));
+                auto c = IC_TIMEALLOCATION(IC::MakeUnique<SmallStruct>(allocator));
+
+                IC::TouchMemory(a.get(), sizeof(*a));
+                IC::TouchMemory(b.get(), sizeof(*b));
+                IC::TouchMemory(c.get(), sizeof(*c));
+
+                IC_TIMEDEALLOCATION(c.reset());
+                IC_TIMEDEALLOCATION(b.reset());
+                IC_TIMEDEALLOCATION(a.reset());
             }
 
             IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numAllocationsPerIteration);
+            IC_SETNUMALLOCATEDBYTES(IC_NUMITERATIONS() * k_numBytesPerIteration);
         }
 
         /// Performs the benchmark with a SmallObjectAllocator
@@ -183,14 +255,25 @@ namespace ICMemoryBenchmark
 
             IC_STARTTIMER();
 
-            for (int i = 0; i < k_numIterations; ++i)
+            IC_ITERATE()
             {
-                auto a = IC::MakeUnique<std::uint32_t>(allocator);
-                auto b = IC::MakeUnique<std::uint64_t>(allocator);
-                auto c = IC::MakeUnique<SmallStruct>(allocator);
+                auto a = IC_TIMEALLOCATION(IC::MakeUnique<std::uint32_t>(allocator));
+                auto b = IC_TIMEALLOCATION(IC::MakeUnique<std::uint64_t>(allocator));
+                auto c = IC_TIMEALLOCATION(IC::MakeUnique<SmallStruct>(allocator));
+
+                IC::TouchMemory(a.get(), sizeof(*a));
+                IC::TouchMemory(b.get(), sizeof(*b));
+                IC::TouchMemory(c.get(), sizeof(*c));
+
+                IC_TIMEDEALLOCATION(c.reset());
+                IC_TIMEDEALLOCATION(b.reset());
+                IC_TIMEDEALLOCATION(a.reset());
             }
 
             IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numAllocationsPerIteration);
+            IC_SETNUMALLOCATEDBYTES(IC_NUMITERATIONS() * k_numBytesPerIteration);
         }
 
         /// Performs the benchmark with ObjectPools
@@ -205,14 +288,25 @@ namespace ICMemoryBenchmark
 
             IC_STARTTIMER();
 
-            for (int i = 0; i < k_numIterations; ++i)
+            IC_ITERATE()
             {
-                auto a = int32Pool.Create();
-                auto b = int64Pool.Create();
-                auto e = smallStructPool.Create();
+                auto a = IC_TIMEALLOCATION(int32Pool.Create());
+                auto b = IC_TIMEALLOCATION(int64Pool.Create());
+                auto e = IC_TIMEALLOCATION(smallStructPool.Create());
+
+                IC::TouchMemory(a.get(), sizeof(*a));
+                IC::TouchMemory(b.get(), sizeof(*b));
+                IC::TouchMemory(e.get(), sizeof(*e));
+
+                IC_TIMEDEALLOCATION(e.reset());
+                IC_TIMEDEALLOCATION(b.reset());
+                IC_TIMEDEALLOCATION(a.reset());
             }
 
             IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numAllocationsPerIteration);
+            IC_SETNUMALLOCATEDBYTES(IC_NUMITERATIONS() * k_numBytesPerIteration);
         }
 
         /// Performs the benchmark with PagedObjectPools
@@ -227,14 +321,25 @@ namespace ICMemoryBenchmark
 
             IC_STARTTIMER();
 
-            for (int i = 0; i < k_numIterations; ++i)
+            IC_ITERATE()
             {
-                auto a = int32Pool.Create();
-                auto b = int64Pool.Create();
-                auto e = smallStructPool.Create();
+                auto a = IC_TIMEALLOCATION(int32Pool.Create());
+                auto b = IC_TIMEALLOCATION(int64Pool.Create());
+                auto e = IC_TIMEALLOCATION(smallStructPool.Create());
+
+                IC::TouchMemory(a.get(), sizeof(*a));
+                IC::TouchMemory(b.get(), sizeof(*b));
+                IC::TouchMemory(e.get(), sizeof(*e));
+
+                IC_TIMEDEALLOCATION(e.reset());
+                IC_TIMEDEALLOCATION(b.reset());
+                IC_TIMEDEALLOCATION(a.reset());
             }
 
             IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * k_numAllocationsPerIteration);
+            IC_SETNUMALLOCATEDBYTES(IC_NUMITERATIONS() * k_numBytesPerIteration);
         }
     }
 }
\ No newline at end of file
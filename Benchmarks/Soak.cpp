@@ -0,0 +1,248 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "AllocationReplay.h"
+#include "TrackingAllocator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace ICMemoryBenchmark
+{
+    namespace
+    {
+        const std::string k_benchmarkGroupName = "Soak";
+
+        constexpr std::uint32_t k_seed = 1;
+        constexpr std::uint64_t k_operationsPerCheck = 1024;
+        constexpr std::size_t k_minAllocationSize = 16;
+        constexpr std::size_t k_maxAllocationSize = 64 * 1024;
+
+        constexpr std::size_t k_buddyAllocatorSize = 64 * 1024 * 1024;
+        constexpr std::size_t k_buddyMinBlockSize = 64;
+        constexpr std::uint64_t k_buddyTargetLiveBytes = 16 * 1024 * 1024;
+        constexpr std::size_t k_smallObjectAllocatorSize = 1024 * 1024;
+        constexpr std::uint64_t k_smallObjectTargetLiveBytes = 256 * 1024;
+        constexpr std::size_t k_blockSize = 64;
+        constexpr std::size_t k_numBlocks = 16 * 1024;
+        constexpr std::uint64_t k_blockTargetLiveBytes = 512 * 1024;
+        constexpr std::size_t k_numBlocksPerPage = 1024;
+        constexpr std::uint64_t k_pagedBlockTargetLiveBytes = 4 * 1024 * 1024;
+
+        /// An allocation which is live during a soak.
+        ///
+        struct SoakAllocation final
+        {
+            void* m_pointer;
+            std::size_t m_size;
+        };
+
+        /// @param random
+        ///        The random number generator.
+        /// @param maxSize
+        ///        The largest size which may be returned.
+        ///
+        /// @return An allocation size between k_minAllocationSize and the given
+        /// maximum, distributed uniformly in its logarithm so that small sizes
+        /// are far more common than large ones.
+        ///
+        std::size_t SampleSize(std::mt19937& random, std::size_t maxSize) noexcept
+        {
+            auto minSize = std::min(k_minAllocationSize, maxSize);
+            auto fraction = static_cast<double>(random()) / 4294967296.0;
+            auto size = static_cast<std::size_t>(static_cast<double>(minSize) * std::pow(static_cast<double>(maxSize) / static_cast<double>(minSize), fraction));
+            return std::max(minSize, std::min(size, maxSize));
+        }
+
+        /// Finds the largest single allocation the given allocator can currently
+        /// satisfy with a binary search, freeing each successful probe. This
+        /// falls as the allocator fragments even if the free space doesn't.
+        ///
+        /// @param allocator
+        ///        The allocator.
+        ///
+        /// @return The size in bytes of the largest allocation.
+        ///
+        std::uint64_t FindLargestAllocation(IC::IAllocator& allocator) noexcept
+        {
+            std::size_t smallest = 0;
+            std::size_t largest = allocator.GetMaxAllocationSize();
+            while (smallest < largest)
+            {
+                auto size = smallest + (largest - smallest) / 2 + 1;
+                auto pointer = allocator.Allocate(size);
+                if (pointer)
+                {
+                    allocator.Deallocate(pointer);
+                    smallest = size;
+                }
+                else
+                {
+                    largest = size - 1;
+                }
+            }
+
+            return smallest;
+        }
+
+        /// Drives a randomised allocate and free workload against the given
+        /// allocator until the soak duration elapses. While the live bytes are
+        /// under the target three in four operations allocate, and above it
+        /// every operation frees a random live allocation, so the heap churns
+        /// around the target. A snapshot is recorded whenever one is due, and
+        /// at the end if any operations were performed since the last.
+        ///
+        /// Failed allocations are counted rather than treated as errors, as a
+        /// fragmented allocator may legitimately be unable to satisfy them.
+        ///
+        /// @param context_
+        ///        The context of the benchmark.
+        /// @param allocator
+        ///        The allocator to soak.
+        /// @param parent
+        ///        The parent of the allocator, which tracks its reserved bytes.
+        /// @param targetLiveBytes
+        ///        The number of live bytes the workload churns around.
+        ///
+        void Soak(IC::BenchmarkContext& context_, IC::IAllocator& allocator, const TrackingAllocator& parent, std::uint64_t targetLiveBytes) noexcept
+        {
+            std::mt19937 random(k_seed);
+            auto maxSize = std::min(k_maxAllocationSize, allocator.GetMaxAllocationSize());
+
+            std::vector<SoakAllocation> allocations;
+            std::uint64_t liveBytes = 0;
+            std::uint64_t numBytes = 0;
+            std::uint64_t numOperations = 0;
+            std::uint64_t numFailedAllocations = 0;
+            std::uint64_t numSnapshotOperations = 0;
+
+            IC_STARTTIMER();
+
+            while (!IC_SOAKCOMPLETE())
+            {
+                for (std::uint64_t i = 0; i < k_operationsPerCheck; ++i)
+                {
+                    auto allocate = liveBytes < targetLiveBytes && (allocations.empty() || random() % 4 != 0);
+                    if (allocate)
+                    {
+                        auto size = SampleSize(random, maxSize);
+                        auto pointer = IC_TIMEALLOCATION(allocator.Allocate(size));
+                        if (pointer)
+                        {
+                            IC::TouchMemory(pointer, size);
+                            allocations.push_back(SoakAllocation{ pointer, size });
+                            liveBytes += size;
+                            numBytes += size;
+                        }
+                        else
+                        {
+                            ++numFailedAllocations;
+                        }
+                    }
+                    else
+                    {
+                        auto index = random() % allocations.size();
+                        IC_TIMEDEALLOCATION(allocator.Deallocate(allocations[index].m_pointer));
+                        liveBytes -= allocations[index].m_size;
+                        allocations[index] = allocations.back();
+                        allocations.pop_back();
+                    }
+
+                    ++numOperations;
+                }
+
+                if (IC_SNAPSHOTDUE())
+                {
+                    IC_PAUSETIMER();
+                    IC_RECORDSNAPSHOT(numOperations, liveBytes, parent.GetAllocatedBytes(), FindLargestAllocation(allocator));
+                    IC_RESUMETIMER();
+                    numSnapshotOperations = numOperations;
+                }
+            }
+
+            IC_STOPTIMER();
+
+            if (numOperations > numSnapshotOperations)
+            {
+                IC_RECORDSNAPSHOT(numOperations, liveBytes, parent.GetAllocatedBytes(), FindLargestAllocation(allocator));
+            }
+
+            for (const auto& allocation : allocations)
+            {
+                allocator.Deallocate(allocation.m_pointer);
+            }
+
+            IC_SETNUMOPERATIONS(numOperations);
+            IC_SETNUMALLOCATEDBYTES(numBytes);
+            IC_SETCOUNTER("failedAllocations", numFailedAllocations);
+        }
+
+        /// Registers a soak benchmark for each ICMemory allocator which supports
+        /// freeing individual allocations. Each allocator takes its memory from
+        /// a TrackingAllocator so that its reserved bytes can be reported.
+        ///
+        /// @return Whether or not the benchmarks were registered.
+        ///
+        bool RegisterSoakBenchmarks() noexcept
+        {
+            auto& registry = IC::BenchmarkRegistry::Get();
+
+            registry.RegisterSoakBenchmark(IC::Benchmark(k_benchmarkGroupName, "BuddyAllocator", [](IC::BenchmarkContext& context) noexcept
+            {
+                StandardAllocator standardAllocator;
+                TrackingAllocator parent(standardAllocator);
+                IC::BuddyAllocator allocator(parent, k_buddyAllocatorSize, k_buddyMinBlockSize);
+                Soak(context, allocator, parent, k_buddyTargetLiveBytes);
+            }));
+
+            registry.RegisterSoakBenchmark(IC::Benchmark(k_benchmarkGroupName, "SmallObjectAllocator", [](IC::BenchmarkContext& context) noexcept
+            {
+                StandardAllocator standardAllocator;
+                TrackingAllocator parent(standardAllocator);
+                IC::SmallObjectAllocator allocator(parent, k_smallObjectAllocatorSize);
+                Soak(context, allocator, parent, k_smallObjectTargetLiveBytes);
+            }));
+
+            registry.RegisterSoakBenchmark(IC::Benchmark(k_benchmarkGroupName, "BlockAllocator", [](IC::BenchmarkContext& context) noexcept
+            {
+                StandardAllocator standardAllocator;
+                TrackingAllocator parent(standardAllocator);
+                IC::BlockAllocator allocator(parent, k_blockSize, k_numBlocks);
+                Soak(context, allocator, parent, k_blockTargetLiveBytes);
+            }));
+
+            registry.RegisterSoakBenchmark(IC::Benchmark(k_benchmarkGroupName, "PagedBlockAllocator", [](IC::BenchmarkContext& context) noexcept
+            {
+                StandardAllocator standardAllocator;
+                TrackingAllocator parent(standardAllocator);
+                IC::PagedBlockAllocator allocator(parent, k_blockSize, k_numBlocksPerPage);
+                Soak(context, allocator, parent, k_pagedBlockTargetLiveBytes);
+            }));
+
+            return true;
+        }
+
+        const bool k_registered = RegisterSoakBenchmarks();
+    }
+}
\ No newline at end of file
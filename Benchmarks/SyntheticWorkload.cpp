@@ -0,0 +1,190 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "AllocationReplay.h"
+
+#include <memory>
+#include <vector>
+
+namespace ICMemoryBenchmark
+{
+    namespace
+    {
+        const std::string k_benchmarkGroupName = "SyntheticWorkload";
+
+        constexpr std::uint64_t k_numAllocations = 20000;
+        constexpr std::uint32_t k_seed = 1;
+
+        /// @return A workload of small objects of uniformly distributed size
+        /// with exponentially distributed lifetimes.
+        ///
+        IC::Workload CreateUniformWorkload() noexcept
+        {
+            IC::WorkloadComponent component;
+            component.m_minSize = 8;
+            component.m_maxSize = 256;
+            component.m_meanLifetime = 100.0;
+
+            IC::Workload workload;
+            workload.m_components.push_back(component);
+            workload.m_targetLiveBytes = 1024 * 1024;
+            return workload;
+        }
+
+        /// @return A workload of power-law distributed sizes, which are mostly
+        /// small with a long tail up to 64KB, with exponentially distributed
+        /// lifetimes.
+        ///
+        IC::Workload CreatePowerLawWorkload() noexcept
+        {
+            IC::WorkloadComponent component;
+            component.m_sizeDistribution = IC::SizeDistribution::k_powerLaw;
+            component.m_minSize = 8;
+            component.m_maxSize = 64 * 1024;
+            component.m_powerLawExponent = 2.0;
+            component.m_meanLifetime = 1000.0;
+
+            IC::Workload workload;
+            workload.m_components.push_back(component);
+            workload.m_targetLiveBytes = 4 * 1024 * 1024;
+            return workload;
+        }
+
+        /// @return A workload with sizes drawn from a histogram typical of
+        /// general purpose application code, with a bimodal lifetime: most
+        /// objects are temporaries but a few live for the whole workload.
+        ///
+        IC::Workload CreateHistogramWorkload() noexcept
+        {
+            IC::WorkloadComponent component;
+            component.m_sizeDistribution = IC::SizeDistribution::k_histogram;
+            component.m_sizeHistogram = { { 16, 40.0 }, { 32, 25.0 }, { 64, 15.0 }, { 128, 10.0 }, { 512, 6.0 }, { 4096, 3.0 }, { 64 * 1024, 1.0 } };
+            component.m_lifetimeDistribution = IC::LifetimeDistribution::k_bimodal;
+            component.m_meanLifetime = 10.0;
+            component.m_longMeanLifetime = 10000.0;
+            component.m_longLivedFraction = 0.05;
+
+            IC::Workload workload;
+            workload.m_components.push_back(component);
+            workload.m_targetLiveBytes = 4 * 1024 * 1024;
+            return workload;
+        }
+
+        /// @return A workload of many tiny, short-lived objects mixed with a few
+        /// large buffers which live far longer.
+        ///
+        IC::Workload CreateTinyAndLargeWorkload() noexcept
+        {
+            IC::WorkloadComponent tiny;
+            tiny.m_weight = 0.99;
+            tiny.m_minSize = 8;
+            tiny.m_maxSize = 64;
+            tiny.m_meanLifetime = 20.0;
+
+            IC::WorkloadComponent large;
+            large.m_weight = 0.01;
+            large.m_minSize = 64 * 1024;
+            large.m_maxSize = 1024 * 1024;
+            large.m_meanLifetime = 5000.0;
+
+            IC::Workload workload;
+            workload.m_components.push_back(tiny);
+            workload.m_components.push_back(large);
+            workload.m_targetLiveBytes = 16 * 1024 * 1024;
+            return workload;
+        }
+
+        /// Times the calibrated number of iterations, each of which replays the
+        /// whole generated sequence. Every allocation is freed by the end of
+        /// the sequence, so nothing needs to be done between iterations. The
+        /// number of allocations per sequence which fell back to malloc() is
+        /// reported as the "fallbackAllocations" counter.
+        ///
+        /// @param context_
+        ///        The context of the benchmark.
+        /// @param allocator
+        ///        The allocator to replay the sequence against.
+        /// @param generator
+        ///        The generated sequence.
+        ///
+        void ReplayWorkload(IC::BenchmarkContext& context_, IC::IAllocator& allocator, const IC::WorkloadGenerator& generator) noexcept
+        {
+            std::vector<ReplaySlot> slots(static_cast<std::size_t>(generator.GetNumSlots()));
+            std::uint64_t numBytes = 0;
+            std::uint64_t numFallbacks = 0;
+
+            IC_STARTTIMER();
+
+            IC_ITERATE()
+            {
+                auto result = ReplayRecords(context_, allocator, generator.GetRecords(), generator.GetNumRecords(), slots);
+                numBytes += result.m_numBytes;
+                numFallbacks += result.m_numFallbacks;
+            }
+
+            IC_STOPTIMER();
+
+            IC_SETNUMOPERATIONS(IC_NUMITERATIONS() * generator.GetNumRecords());
+            IC_SETNUMALLOCATEDBYTES(numBytes);
+            IC_SETCOUNTER("fallbackAllocations", static_cast<double>(numFallbacks) / static_cast<double>(IC_NUMITERATIONS()));
+        }
+
+        /// Generates the given workload and registers a benchmark which replays
+        /// it against each allocator sized to serve it.
+        ///
+        /// @param workloadName
+        ///        The name of the workload, which prefixes each benchmark name.
+        /// @param workload
+        ///        The workload.
+        ///
+        void RegisterWorkload(const std::string& workloadName, IC::Workload workload) noexcept
+        {
+            workload.m_numAllocations = k_numAllocations;
+            workload.m_seed = k_seed;
+
+            auto generator = std::make_shared<const IC::WorkloadGenerator>(workload);
+            ReplayRequirements requirements;
+            requirements.m_maxAllocationSize = generator->GetMaxAllocationSize();
+            requirements.m_peakLiveBytes = generator->GetPeakLiveBytes();
+
+            RegisterAllocatorBenchmarks(k_benchmarkGroupName, workloadName + "/", requirements, [generator](IC::BenchmarkContext& context, IC::IAllocator& allocator, ReplayAllocator) noexcept
+            {
+                ReplayWorkload(context, allocator, *generator);
+            });
+        }
+
+        /// Registers the benchmarks for every workload.
+        ///
+        /// @return Whether or not the benchmarks were registered.
+        ///
+        bool RegisterWorkloads() noexcept
+        {
+            RegisterWorkload("Uniform", CreateUniformWorkload());
+            RegisterWorkload("PowerLaw", CreatePowerLawWorkload());
+            RegisterWorkload("Histogram", CreateHistogramWorkload());
+            RegisterWorkload("TinyAndLarge", CreateTinyAndLargeWorkload());
+            return true;
+        }
+
+        const bool k_registered = RegisterWorkloads();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "TrackingAllocator.h"
+
+#include <cstddef>
+
+namespace ICMemoryBenchmark
+{
+    namespace
+    {
+        constexpr std::size_t k_headerSize = alignof(std::max_align_t) > sizeof(std::size_t) ? alignof(std::max_align_t) : sizeof(std::size_t);
+    }
+
+    //------------------------------------------------------------------------------
+    TrackingAllocator::TrackingAllocator(IC::IAllocator& allocator) noexcept
+        : m_allocator(allocator)
+    {
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t TrackingAllocator::GetMaxAllocationSize() const noexcept
+    {
+        auto maxAllocationSize = m_allocator.GetMaxAllocationSize();
+        return maxAllocationSize > k_headerSize ? maxAllocationSize - k_headerSize : 0;
+    }
+
+    //------------------------------------------------------------------------------
+    void* TrackingAllocator::Allocate(std::size_t allocationSize) noexcept
+    {
+        auto header = static_cast<std::uint8_t*>(m_allocator.Allocate(allocationSize + k_headerSize));
+        if (!header)
+        {
+            return nullptr;
+        }
+
+        *reinterpret_cast<std::size_t*>(header) = allocationSize;
+        m_allocatedBytes += allocationSize;
+        return header + k_headerSize;
+    }
+
+    //------------------------------------------------------------------------------
+    void TrackingAllocator::Deallocate(void* pointer) noexcept
+    {
+        auto header = static_cast<std::uint8_t*>(pointer) - k_headerSize;
+        m_allocatedBytes -= *reinterpret_cast<std::size_t*>(header);
+        m_allocator.Deallocate(header);
+    }
+}
\ No newline at end of file
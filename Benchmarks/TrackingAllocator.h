@@ -0,0 +1,67 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICMEMORYBENCHMARK_TRACKINGALLOCATOR_H_
+#define _ICMEMORYBENCHMARK_TRACKINGALLOCATOR_H_
+
+#include "../ICMemory/ICMemory.h"
+
+#include <cstdint>
+
+namespace ICMemoryBenchmark
+{
+    /// An allocator which forwards to another, keeping count of the bytes which
+    /// are currently allocated from it. Using this as the parent of an ICMemory
+    /// allocator shows how much memory that allocator has reserved. The size of
+    /// each allocation is stored in a header in front of it.
+    ///
+    /// This is not thread-safe.
+    ///
+    class TrackingAllocator final : public IC::IAllocator
+    {
+    public:
+        /// @param allocator
+        ///        The allocator to forward to. This must outlive the tracking
+        ///        allocator.
+        ///
+        TrackingAllocator(IC::IAllocator& allocator) noexcept;
+
+        /// @return The number of bytes currently allocated, excluding headers.
+        ///
+        std::uint64_t GetAllocatedBytes() const noexcept { return m_allocatedBytes; }
+
+        std::size_t GetMaxAllocationSize() const noexcept override;
+
+        void* Allocate(std::size_t allocationSize) noexcept override;
+
+        void Deallocate(void* pointer) noexcept override;
+
+    private:
+        TrackingAllocator(const TrackingAllocator&) = delete;
+        TrackingAllocator& operator=(const TrackingAllocator&) = delete;
+
+        IC::IAllocator& m_allocator;
+        std::uint64_t m_allocatedBytes = 0;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,235 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "AllocationTrace.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace IC
+{
+    //------------------------------------------------------------------------------
+    AllocationTrace::AllocationTrace(const std::string& path) noexcept
+    {
+#if defined(_WIN32)
+        auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            Fail("Could not open '" + path + "'.");
+            return;
+        }
+        m_fileHandle = file;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize))
+        {
+            Fail("Could not read the size of '" + path + "'.");
+            return;
+        }
+        m_mappingSize = static_cast<std::size_t>(fileSize.QuadPart);
+
+        if (m_mappingSize >= sizeof(AllocationTraceHeader))
+        {
+            m_mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (m_mappingHandle)
+            {
+                m_mapping = MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+            }
+        }
+#else
+        auto file = open(path.c_str(), O_RDONLY);
+        if (file < 0)
+        {
+            Fail("Could not open '" + path + "'.");
+            return;
+        }
+
+        struct stat fileStatus;
+        if (fstat(file, &fileStatus) != 0)
+        {
+            close(file);
+            Fail("Could not read the size of '" + path + "'.");
+            return;
+        }
+        m_mappingSize = static_cast<std::size_t>(fileStatus.st_size);
+
+        if (m_mappingSize >= sizeof(AllocationTraceHeader))
+        {
+            auto mapping = mmap(nullptr, m_mappingSize, PROT_READ, MAP_PRIVATE, file, 0);
+            if (mapping != MAP_FAILED)
+            {
+                madvise(mapping, m_mappingSize, MADV_SEQUENTIAL);
+                m_mapping = mapping;
+            }
+        }
+
+        close(file);
+#endif
+
+        if (m_mappingSize < sizeof(AllocationTraceHeader))
+        {
+            Fail("'" + path + "' is too small to be an allocation trace.");
+            return;
+        }
+
+        if (!m_mapping)
+        {
+            Fail("Could not map '" + path + "' into memory.");
+            return;
+        }
+
+        AllocationTraceHeader header;
+        std::memcpy(&header, m_mapping, sizeof(header));
+        if (header.m_magic != AllocationTraceHeader::k_magic || header.m_version != AllocationTraceHeader::k_version || header.m_recordSize != sizeof(AllocationTraceRecord))
+        {
+            Fail("'" + path + "' is not an allocation trace, or was written by an incompatible version of the tracer.");
+            return;
+        }
+
+        auto records = reinterpret_cast<const AllocationTraceRecord*>(static_cast<const std::uint8_t*>(m_mapping) + sizeof(AllocationTraceHeader));
+        auto numRecordsInFile = static_cast<std::uint64_t>((m_mappingSize - sizeof(AllocationTraceHeader)) / sizeof(AllocationTraceRecord));
+
+        m_numRecords = header.m_numRecords > 0 ? std::min(header.m_numRecords, numRecordsInFile) : numRecordsInFile;
+        m_numSlots = header.m_numSlots;
+        m_numThreads = header.m_numThreads;
+
+        if (header.m_numRecords == 0)
+        {
+            for (std::uint64_t i = 0; i < m_numRecords; ++i)
+            {
+                m_numSlots = std::max(m_numSlots, static_cast<std::uint64_t>(records[i].m_slot) + 1);
+                m_numThreads = std::max(m_numThreads, static_cast<std::uint32_t>(records[i].m_thread) + 1);
+            }
+        }
+
+        std::vector<std::uint64_t> slotSizes(static_cast<std::size_t>(m_numSlots), 0);
+        std::uint64_t liveBytes = 0;
+
+        for (std::uint64_t i = 0; i < m_numRecords; ++i)
+        {
+            const auto& record = records[i];
+            auto error = ValidateRecord(record);
+            if (!error.empty())
+            {
+                Fail("'" + path + "' is corrupt: record " + std::to_string(i) + " " + error + ".");
+                return;
+            }
+
+            auto& slotSize = slotSizes[record.m_slot];
+            liveBytes -= slotSize;
+            slotSize = 0;
+
+            if (record.m_event == static_cast<std::uint8_t>(AllocationTraceEvent::k_allocate))
+            {
+                slotSize = record.m_size;
+                liveBytes += slotSize;
+                m_peakLiveBytes = std::max(m_peakLiveBytes, liveBytes);
+                m_maxAllocationSize = std::max(m_maxAllocationSize, record.m_size);
+            }
+        }
+
+        m_records = records;
+    }
+
+    //------------------------------------------------------------------------------
+    std::string AllocationTrace::ValidateRecord(const AllocationTraceRecord& record) const noexcept
+    {
+        if (record.m_event != static_cast<std::uint8_t>(AllocationTraceEvent::k_allocate) && record.m_event != static_cast<std::uint8_t>(AllocationTraceEvent::k_deallocate))
+        {
+            return "has an unknown event type " + std::to_string(record.m_event);
+        }
+
+        if (record.m_slot >= m_numSlots)
+        {
+            return "uses slot " + std::to_string(record.m_slot) + ", but the trace only has " + std::to_string(m_numSlots) + " slots";
+        }
+
+        if (record.m_thread >= m_numThreads)
+        {
+            return "was made by thread " + std::to_string(record.m_thread) + ", but the trace only has " + std::to_string(m_numThreads) + " threads";
+        }
+
+        if (record.m_alignmentLog2 >= std::numeric_limits<std::size_t>::digits)
+        {
+            return "requests an alignment of 2^" + std::to_string(record.m_alignmentLog2) + " bytes";
+        }
+
+        return std::string();
+    }
+
+    //------------------------------------------------------------------------------
+    void AllocationTrace::Fail(const std::string& error) noexcept
+    {
+        m_error = error;
+        Unmap();
+    }
+
+    //------------------------------------------------------------------------------
+    void AllocationTrace::Unmap() noexcept
+    {
+#if defined(_WIN32)
+        if (m_mapping)
+        {
+            UnmapViewOfFile(m_mapping);
+        }
+
+        if (m_mappingHandle)
+        {
+            CloseHandle(m_mappingHandle);
+        }
+
+        if (m_fileHandle)
+        {
+            CloseHandle(m_fileHandle);
+        }
+#else
+        if (m_mapping)
+        {
+            munmap(m_mapping, m_mappingSize);
+        }
+#endif
+
+        m_mapping = nullptr;
+        m_mappingHandle = nullptr;
+        m_fileHandle = nullptr;
+        m_records = nullptr;
+    }
+
+    //------------------------------------------------------------------------------
+    AllocationTrace::~AllocationTrace() noexcept
+    {
+        Unmap();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,140 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_ALLOCATIONTRACE_H_
+#define _ICBENCHMARK_ALLOCATIONTRACE_H_
+
+#include "AllocationTraceFormat.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace IC
+{
+    /// A read-only view of an allocation trace file, as written by the
+    /// AllocationTracer tool. The file is memory mapped rather than read, and
+    /// the operating system is told it will be accessed sequentially, so
+    /// traces many times larger than physical memory can be replayed: pages
+    /// are read ahead of the replay and dropped once it has passed them.
+    ///
+    /// This is thread-safe, as the mapping is never modified after creation.
+    ///
+    class AllocationTrace final
+    {
+    public:
+        /// The environment variable which holds the path of the trace file,
+        /// both when recording with the tracer and when replaying.
+        ///
+        static constexpr const char* k_pathVariable = "IC_ALLOCATION_TRACE";
+
+        /// Maps the given trace file. If it can't be opened or isn't a valid
+        /// trace, IsOpen() returns false and GetError() describes why. Every
+        /// record is checked when the trace is opened, so a truncated or
+        /// corrupt trace is rejected rather than replayed out of bounds. The
+        /// peak live bytes and largest allocation are measured in the same pass.
+        ///
+        /// @param path
+        ///        The path to the trace file.
+        ///
+        AllocationTrace(const std::string& path) noexcept;
+
+        /// @return Whether or not the trace was successfully opened.
+        ///
+        bool IsOpen() const noexcept { return m_records != nullptr; }
+
+        /// @return A description of why the trace couldn't be opened, or an
+        /// empty string if it was.
+        ///
+        const std::string& GetError() const noexcept { return m_error; }
+
+        /// @return The records in the trace, in the order they were recorded.
+        ///
+        const AllocationTraceRecord* GetRecords() const noexcept { return m_records; }
+
+        /// @return The number of records in the trace.
+        ///
+        std::uint64_t GetNumRecords() const noexcept { return m_numRecords; }
+
+        /// @return The number of slots used by the trace, which is the largest
+        /// number of allocations that were ever live at once.
+        ///
+        std::uint64_t GetNumSlots() const noexcept { return m_numSlots; }
+
+        /// @return The number of threads which made calls during the trace.
+        ///
+        std::uint32_t GetNumThreads() const noexcept { return m_numThreads; }
+
+        /// @return The largest number of bytes live at once, counting the
+        /// requested sizes.
+        ///
+        std::uint64_t GetPeakLiveBytes() const noexcept { return m_peakLiveBytes; }
+
+        /// @return The size of the largest single allocation.
+        ///
+        std::uint64_t GetMaxAllocationSize() const noexcept { return m_maxAllocationSize; }
+
+        ~AllocationTrace() noexcept;
+
+    private:
+        AllocationTrace(const AllocationTrace&) = delete;
+        AllocationTrace& operator=(const AllocationTrace&) = delete;
+
+        /// Checks that a record can be replayed safely: that its event is known,
+        /// its slot and thread are within the counts of the trace, and its
+        /// alignment can be represented.
+        ///
+        /// @param record
+        ///        The record to check.
+        ///
+        /// @return A description of what is wrong with the record, or an empty
+        /// string if it is valid.
+        ///
+        std::string ValidateRecord(const AllocationTraceRecord& record) const noexcept;
+
+        /// Fails opening the trace, releasing the mapping if it was created.
+        ///
+        /// @param error
+        ///        A description of the failure.
+        ///
+        void Fail(const std::string& error) noexcept;
+
+        /// Releases the mapping and file handles.
+        ///
+        void Unmap() noexcept;
+
+        std::string m_error;
+        const AllocationTraceRecord* m_records = nullptr;
+        std::uint64_t m_numRecords = 0;
+        std::uint64_t m_numSlots = 0;
+        std::uint32_t m_numThreads = 0;
+        std::uint64_t m_peakLiveBytes = 0;
+        std::uint64_t m_maxAllocationSize = 0;
+
+        void* m_mapping = nullptr;
+        std::size_t m_mappingSize = 0;
+        void* m_fileHandle = nullptr;
+        void* m_mappingHandle = nullptr;
+    };
+}
+
+#endif
\ No newline at end of file
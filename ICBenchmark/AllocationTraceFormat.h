@@ -0,0 +1,100 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_ALLOCATIONTRACEFORMAT_H_
+#define _ICBENCHMARK_ALLOCATIONTRACEFORMAT_H_
+
+#include <cstdint>
+
+namespace IC
+{
+    /// The type of event described by an AllocationTraceRecord.
+    ///
+    enum class AllocationTraceEvent : std::uint8_t
+    {
+        k_allocate,
+        k_deallocate
+    };
+
+    /// The header at the start of an allocation trace file, which is followed
+    /// by a flat array of AllocationTraceRecords. The record count and slot
+    /// count are written when the traced process exits. If it didn't exit
+    /// cleanly they are zero, in which case the record count is derived from
+    /// the file size and the slot count by scanning the records.
+    ///
+    /// This is shared by the AllocationTracer tool, which writes traces, and
+    /// AllocationTrace, which reads them, so it must only use fixed size types.
+    ///
+    struct AllocationTraceHeader final
+    {
+        static constexpr std::uint32_t k_magic = 0x54414349; // "ICAT"
+        static constexpr std::uint32_t k_version = 1;
+
+        std::uint32_t m_magic = k_magic;
+        std::uint32_t m_version = k_version;
+        std::uint32_t m_recordSize = 0;
+        std::uint32_t m_numThreads = 0;
+        std::uint64_t m_numRecords = 0;
+        std::uint64_t m_numSlots = 0;
+    };
+
+    /// A single allocation or deallocation in an allocation trace.
+    ///
+    /// Rather than storing addresses, each live allocation is assigned a slot:
+    /// the lowest index not used by any other live allocation. The deallocation
+    /// refers to the same slot, so replaying a trace only needs an array of as
+    /// many pointers as there were ever live allocations at once.
+    ///
+    struct AllocationTraceRecord final
+    {
+        /// The time in nanoseconds since tracing started.
+        ///
+        std::uint64_t m_timestamp;
+
+        /// The requested size in bytes. This is zero for deallocations.
+        ///
+        std::uint64_t m_size;
+
+        /// The slot of the allocation.
+        ///
+        std::uint32_t m_slot;
+
+        /// The index of the thread which made the call, in the order threads
+        /// were first seen, starting at zero.
+        ///
+        std::uint16_t m_thread;
+
+        /// The base two logarithm of the requested alignment, or zero if no
+        /// alignment was requested.
+        ///
+        std::uint8_t m_alignmentLog2;
+
+        /// The event type, stored as an AllocationTraceEvent.
+        ///
+        std::uint8_t m_event;
+    };
+
+    static_assert(sizeof(AllocationTraceHeader) == 32, "The allocation trace header must be tightly packed.");
+    static_assert(sizeof(AllocationTraceRecord) == 24, "Allocation trace records must be tightly packed.");
+}
+
+#endif
\ No newline at end of file
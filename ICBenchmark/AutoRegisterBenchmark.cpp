@@ -24,6 +24,8 @@
 
 #include "AutoRegisterBenchmark.h"
 
+#include "Benchmark.h"
+#include "BenchmarkParameterSpace.h"
 #include "BenchmarkRegistry.h"
 
 namespace IC
@@ -33,4 +35,19 @@ namespace IC
     {
         BenchmarkRegistry::Get().RegisterBenchmark(benchmark);
     }
+
+    //------------------------------------------------------------------------------
+    AutoRegisterBenchmark::AutoRegisterBenchmark(const std::string& benchmarkGroupName, const std::string& benchmarkName, const BenchmarkParameterSpace& parameterSpace,
+        const ParameterisedBenchmarkDelegate& benchmarkDelegate) noexcept
+    {
+        for (const auto& parameters : parameterSpace.GetCombinations())
+        {
+            auto delegate = [benchmarkDelegate, parameters](BenchmarkContext& context) noexcept
+            {
+                benchmarkDelegate(context, parameters);
+            };
+
+            BenchmarkRegistry::Get().RegisterBenchmark(Benchmark(benchmarkGroupName, benchmarkName + parameters.ToString(), delegate, parameters));
+        }
+    }
 }
\ No newline at end of file
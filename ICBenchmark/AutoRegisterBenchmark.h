@@ -27,6 +27,9 @@
 
 #include "ForwardDeclarations.h"
 
+#include <functional>
+#include <string>
+
 namespace IC
 {
     /// This is used to automatically register the wrapped Benchmark with the 
@@ -38,6 +41,16 @@ namespace IC
     class AutoRegisterBenchmark final
     {
     public:
+        /// The function that should be called to perform a parameterised
+        /// benchmark.
+        ///
+        /// @param context
+        ///        The context in which the benchmark is executed.
+        /// @param parameters
+        ///        The parameter values for this instance of the benchmark.
+        ///
+        using ParameterisedBenchmarkDelegate = std::function<void(BenchmarkContext& context, const BenchmarkParameters& parameters) noexcept>;
+
         AutoRegisterBenchmark() = default;
 
         /// Creates new instance and adds the given benchmark to the registry.
@@ -46,6 +59,22 @@ namespace IC
         ///        The benchmark which should be registered.
         ///
         AutoRegisterBenchmark(const Benchmark& benchmark) noexcept;
+
+        /// Creates new instance and adds one benchmark to the registry for
+        /// each combination of values in the given parameter space. Each is
+        /// named after the benchmark followed by its parameter values.
+        ///
+        /// @param benchmarkGroupName
+        ///        The name of the group the benchmarks belong to.
+        /// @param benchmarkName
+        ///        The base name of the benchmarks.
+        /// @param parameterSpace
+        ///        The parameter values to register benchmarks for.
+        /// @param benchmarkDelegate
+        ///        The function which will be executed to perform each benchmark.
+        ///
+        AutoRegisterBenchmark(const std::string& benchmarkGroupName, const std::string& benchmarkName, const BenchmarkParameterSpace& parameterSpace,
+            const ParameterisedBenchmarkDelegate& benchmarkDelegate) noexcept;
     };
 }
 
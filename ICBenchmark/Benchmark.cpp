@@ -27,8 +27,9 @@
 namespace IC
 {
     //------------------------------------------------------------------------------
-    Benchmark::Benchmark(const std::string& benchmarkGroupName, const std::string& benchmarkName, const BenchmarkDelegate& benchmarkDelegate) noexcept
-        : m_benchmarkGroupName(benchmarkGroupName), m_benchmarkName(benchmarkName), m_benchmarkDelegate(benchmarkDelegate)
+    Benchmark::Benchmark(const std::string& benchmarkGroupName, const std::string& benchmarkName, const BenchmarkDelegate& benchmarkDelegate,
+        const BenchmarkParameters& parameters) noexcept
+        : m_benchmarkGroupName(benchmarkGroupName), m_benchmarkName(benchmarkName), m_benchmarkDelegate(benchmarkDelegate), m_parameters(parameters)
     {
     }
 }
\ No newline at end of file
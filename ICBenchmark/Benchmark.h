@@ -25,6 +25,7 @@
 #ifndef _ICBENCHMARK_BENCHMARK_H_
 #define _ICBENCHMARK_BENCHMARK_H_
 
+#include "BenchmarkParameters.h"
 #include "ForwardDeclarations.h"
 
 #include <functional>
@@ -45,10 +46,11 @@ namespace IC
     public:
         /// The function that should be called to perform the benchmark.
         ///
-        /// @param timer
-        ///        The timer which should be used to time the benchmark.
+        /// @param context
+        ///        The context in which the benchmark is executed. This provides
+        ///        the timer which should be used to time the benchmark.
         ///
-        using BenchmarkDelegate = std::function<void(Timer& timer) noexcept>;
+        using BenchmarkDelegate = std::function<void(BenchmarkContext& context) noexcept>;
 
         /// Creates a new instance of the benchmark.
         ///
@@ -58,8 +60,12 @@ namespace IC
         ///        The name of this benchmark.
         /// @param benchmarkDelegate
         ///        The function which will be executed to perform the benchmark.
+        /// @param parameters
+        ///        (Optional) The parameter values of this instance, if it is one
+        ///        instance of a parameterised benchmark.
         ///
-        Benchmark(const std::string& benchmarkGroupName, const std::string& benchmarkName, const BenchmarkDelegate& benchmarkDelegate) noexcept;
+        Benchmark(const std::string& benchmarkGroupName, const std::string& benchmarkName, const BenchmarkDelegate& benchmarkDelegate,
+            const BenchmarkParameters& parameters = BenchmarkParameters()) noexcept;
 
         /// @return The name of the benchmark group.
         ///
@@ -73,10 +79,16 @@ namespace IC
         ///
         const BenchmarkDelegate& GetBenchmarkDelegate() const noexcept { return m_benchmarkDelegate; }
 
+        /// @return The parameter values of this benchmark, which are empty if it
+        /// isn't parameterised.
+        ///
+        const BenchmarkParameters& GetParameters() const noexcept { return m_parameters; }
+
     private:
         std::string m_benchmarkGroupName;
         std::string m_benchmarkName;
         BenchmarkDelegate m_benchmarkDelegate;
+        BenchmarkParameters m_parameters;
     };
 }
 
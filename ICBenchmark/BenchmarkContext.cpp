@@ -0,0 +1,264 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "BenchmarkContext.h"
+
+#include "BenchmarkFixture.h"
+#include "CacheEvictor.h"
+#include "PerformanceCounters.h"
+#include "ResourceUsage.h"
+#include "WorkerPool.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace IC
+{
+    //------------------------------------------------------------------------------
+    BenchmarkContext::BenchmarkContext(std::uint64_t numIterations, PerformanceCounters* performanceCounters, LatencyHistogram* allocationLatencies, LatencyHistogram* deallocationLatencies,
+        ResourceUsageTracker* resourceUsage) noexcept
+        : m_performanceCounters(performanceCounters), m_allocationLatencies(allocationLatencies), m_deallocationLatencies(deallocationLatencies), m_resourceUsage(resourceUsage),
+        m_numIterations(numIterations)
+    {
+    }
+
+    //------------------------------------------------------------------------------
+    void BenchmarkContext::StartTimer() noexcept
+    {
+        if (m_resourceUsage)
+        {
+            m_resourceUsage->Start();
+        }
+
+        if (m_performanceCounters)
+        {
+            m_performanceCounters->Start();
+        }
+
+        ++m_numTimerWindows;
+        m_timer.Start(false);
+    }
+
+    //------------------------------------------------------------------------------
+    void BenchmarkContext::StopTimer() noexcept
+    {
+        assert(!m_paused);
+
+        m_timer.Stop();
+
+        if (m_performanceCounters)
+        {
+            m_performanceCounters->Stop();
+        }
+
+        if (m_resourceUsage)
+        {
+            m_resourceUsage->Stop();
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    void BenchmarkContext::PauseTimer() noexcept
+    {
+        assert(!m_paused);
+
+        m_timer.Stop();
+        m_paused = true;
+
+        if (m_performanceCounters)
+        {
+            m_performanceCounters->Stop();
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    void BenchmarkContext::ResumeTimer() noexcept
+    {
+        assert(m_paused);
+
+        if (m_performanceCounters)
+        {
+            m_performanceCounters->Start();
+        }
+
+        m_paused = false;
+        ++m_numTimerWindows;
+        m_timer.Start(false);
+    }
+
+    //------------------------------------------------------------------------------
+    std::uint64_t BenchmarkContext::GetElapsedTime() const noexcept
+    {
+        auto elapsedTime = m_timer.GetElapsedTime();
+        return elapsedTime - std::min(elapsedTime, m_excludedTime);
+    }
+
+    //------------------------------------------------------------------------------
+    void BenchmarkContext::SetCacheEvictor(CacheEvictor* cacheEvictor, std::uint64_t interval) noexcept
+    {
+        m_cacheEvictor = cacheEvictor;
+        m_evictionInterval = interval;
+    }
+
+    //------------------------------------------------------------------------------
+    void BenchmarkContext::SetSoak(std::uint64_t duration, std::uint64_t snapshotInterval) noexcept
+    {
+        m_soakStart = std::chrono::steady_clock::now();
+        m_soakDuration = duration;
+        m_snapshotInterval = snapshotInterval;
+        m_snapshotElapsedTime = 0;
+        m_snapshots.clear();
+    }
+
+    //------------------------------------------------------------------------------
+    bool BenchmarkContext::IsSoakComplete() const noexcept
+    {
+        return m_soakDuration == 0 || GetSoakTime() >= m_soakDuration;
+    }
+
+    //------------------------------------------------------------------------------
+    bool BenchmarkContext::IsSnapshotDue() const noexcept
+    {
+        if (m_soakDuration == 0)
+        {
+            return false;
+        }
+
+        auto lastSnapshotTime = m_snapshots.empty() ? 0 : m_snapshots.back().m_time;
+        return GetSoakTime() >= lastSnapshotTime + m_snapshotInterval;
+    }
+
+    //------------------------------------------------------------------------------
+    void BenchmarkContext::RecordSnapshot(std::uint64_t numOperations, std::uint64_t liveBytes, std::uint64_t reservedBytes, std::uint64_t largestAllocation) noexcept
+    {
+        assert(!IsTimerRunning());
+
+        auto elapsedTime = GetElapsedTime();
+        auto previousNumOperations = m_snapshots.empty() ? 0 : m_snapshots.back().m_numOperations;
+
+        SoakSnapshot snapshot;
+        snapshot.m_time = GetSoakTime();
+        snapshot.m_numOperations = numOperations;
+        if (elapsedTime > m_snapshotElapsedTime)
+        {
+            snapshot.m_operationsPerSecond = static_cast<double>(numOperations - previousNumOperations) * 1000000000.0 / static_cast<double>(elapsedTime - m_snapshotElapsedTime);
+        }
+        snapshot.m_liveBytes = liveBytes;
+        snapshot.m_reservedBytes = reservedBytes;
+        snapshot.m_largestAllocation = largestAllocation;
+        snapshot.m_residentBytes = ResourceUsageTracker::GetResidentSize();
+
+        m_snapshotElapsedTime = elapsedTime;
+        m_snapshots.push_back(snapshot);
+    }
+
+    //------------------------------------------------------------------------------
+    void BenchmarkContext::BeginIteration(std::uint64_t index) noexcept
+    {
+        auto setUp = m_fixture && m_fixture->HasSetUpIteration() && index % m_fixture->GetIterationInterval() == 0;
+        auto evict = m_cacheEvictor && m_evictionInterval > 0 && index % m_evictionInterval == 0;
+        if (!setUp && !evict)
+        {
+            return;
+        }
+
+        auto running = IsTimerRunning();
+        if (running)
+        {
+            PauseTimer();
+        }
+
+        if (setUp)
+        {
+            m_fixture->SetUpIteration();
+        }
+
+        if (evict)
+        {
+            Timer evictionTimer;
+            m_cacheEvictor->Evict();
+            evictionTimer.Stop();
+            m_evictionTime += evictionTimer.GetElapsedTime();
+        }
+
+        if (running)
+        {
+            ResumeTimer();
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    void BenchmarkContext::EndIteration(std::uint64_t index) noexcept
+    {
+        auto endOfInterval = (index + 1) % m_fixture->GetIterationInterval() == 0 || index + 1 == m_numIterations;
+        if (!m_fixture->HasTearDownIteration() || !endOfInterval)
+        {
+            return;
+        }
+
+        auto running = IsTimerRunning();
+        if (running)
+        {
+            PauseTimer();
+        }
+
+        m_fixture->TearDownIteration();
+
+        if (running)
+        {
+            ResumeTimer();
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    void BenchmarkContext::RunThreads(std::uint32_t numThreads, const ThreadWork& work) noexcept
+    {
+        assert(!IsTimerRunning());
+
+        WorkerPool workerPool(numThreads, work, m_workerCpus ? *m_workerCpus : std::vector<std::uint32_t>());
+
+        StartTimer();
+        workerPool.Release();
+        workerPool.WaitForCompletion();
+        StopTimer();
+
+        const auto& threadTimes = workerPool.GetThreadTimes();
+        m_threadTimes.resize(std::max(m_threadTimes.size(), threadTimes.size()), 0);
+        for (std::size_t i = 0; i < threadTimes.size(); ++i)
+        {
+            m_threadTimes[i] += threadTimes[i];
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    std::uint64_t BenchmarkContext::GetSoakTime() const noexcept
+    {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_soakStart).count());
+    }
+
+    //------------------------------------------------------------------------------
+    std::uint64_t BenchmarkContext::GetNumIterations() noexcept
+    {
+        m_iterationBased = true;
+        return m_numIterations;
+    }
+}
\ No newline at end of file
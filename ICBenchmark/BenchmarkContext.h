@@ -0,0 +1,497 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_BENCHMARKCONTEXT_H_
+#define _ICBENCHMARK_BENCHMARKCONTEXT_H_
+
+#include "ForwardDeclarations.h"
+#include "SoakSnapshot.h"
+#include "Timer.h"
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace IC
+{
+    /// The context in which a single benchmark is executed. This is passed to
+    /// the benchmark function and provides the timer used to measure the
+    /// benchmark, along with the means for the benchmark to describe the work
+    /// it performed.
+    ///
+    /// Benchmarks should typically interact with the context via the macros
+    /// declared in BenchmarkGroup.h.
+    ///
+    /// This is not thread-safe.
+    ///
+    class BenchmarkContext final
+    {
+    public:
+        /// The work performed by each thread of a multi-threaded benchmark.
+        ///
+        /// @param threadIndex
+        ///        The index of the thread, in the range [0, numThreads).
+        ///
+        using ThreadWork = std::function<void(std::uint32_t threadIndex) noexcept>;
+
+        /// A range over the calibrated number of iterations, for use in a range
+        /// based for loop. If a fixture with per-iteration setup or teardown is
+        /// attached to the context, these are called before and after each
+        /// interval of iterations requested by the fixture with the timer paused. Likewise, if a cache evictor is set
+        /// the caches are evicted before iterations at the requested interval.
+        ///
+        class IterationRange final
+        {
+        public:
+            /// A single iteration, which exists for the duration of the loop
+            /// body. Creating the iteration begins it and destroying it ends it,
+            /// so the teardown is performed even if the loop is exited early.
+            ///
+            class Iteration final
+            {
+            public:
+                /// @param context
+                ///        The context which owns the range.
+                /// @param index
+                ///        The index of the iteration.
+                ///
+                Iteration(BenchmarkContext& context, std::uint64_t index) noexcept
+                    : m_context(&context), m_index(index)
+                {
+                    if (m_context->m_fixture || m_context->m_cacheEvictor)
+                    {
+                        m_context->BeginIteration(index);
+                    }
+                }
+
+                /// @param other
+                ///        The iteration to move from, which will no longer end
+                ///        the iteration when destroyed.
+                ///
+                Iteration(Iteration&& other) noexcept
+                    : m_context(other.m_context), m_index(other.m_index)
+                {
+                    other.m_context = nullptr;
+                }
+
+                /// @return The index of the iteration.
+                ///
+                std::uint64_t GetIndex() const noexcept { return m_index; }
+
+                ~Iteration() noexcept
+                {
+                    if (m_context && m_context->m_fixture)
+                    {
+                        m_context->EndIteration(m_index);
+                    }
+                }
+
+            private:
+                Iteration(const Iteration&) = delete;
+                Iteration& operator=(const Iteration&) = delete;
+                Iteration& operator=(Iteration&&) = delete;
+
+                BenchmarkContext* m_context;
+                std::uint64_t m_index;
+            };
+
+            /// An iterator over the range.
+            ///
+            class Iterator final
+            {
+            public:
+                /// @param context
+                ///        The context which owns the range.
+                /// @param index
+                ///        The index of the iteration.
+                ///
+                Iterator(BenchmarkContext& context, std::uint64_t index) noexcept
+                    : m_context(context), m_index(index)
+                {
+                }
+
+                /// Begins the current iteration.
+                ///
+                /// @return The iteration, which ends when it is destroyed.
+                ///
+                Iteration operator*() const noexcept { return Iteration(m_context, m_index); }
+
+                /// Moves to the next iteration.
+                ///
+                /// @return This iterator.
+                ///
+                Iterator& operator++() noexcept
+                {
+                    ++m_index;
+                    return *this;
+                }
+
+                /// @param other
+                ///        The iterator to compare with.
+                ///
+                /// @return Whether or not the iterators refer to different
+                /// iterations.
+                ///
+                bool operator!=(const Iterator& other) const noexcept { return m_index != other.m_index; }
+
+            private:
+                BenchmarkContext& m_context;
+                std::uint64_t m_index;
+            };
+
+            /// @param context
+            ///        The context which owns the range.
+            /// @param numIterations
+            ///        The number of iterations.
+            ///
+            IterationRange(BenchmarkContext& context, std::uint64_t numIterations) noexcept
+                : m_context(context), m_numIterations(numIterations)
+            {
+            }
+
+            /// @return An iterator to the first iteration.
+            ///
+            Iterator begin() const noexcept { return Iterator(m_context, 0); }
+
+            /// @return An iterator past the last iteration.
+            ///
+            Iterator end() const noexcept { return Iterator(m_context, m_numIterations); }
+
+        private:
+            BenchmarkContext& m_context;
+            std::uint64_t m_numIterations;
+        };
+
+        /// Creates a new context for a run of a benchmark.
+        ///
+        /// @param numIterations
+        ///        The number of iterations the benchmark should perform.
+        /// @param performanceCounters
+        ///        (Optional) The performance counters which should count while
+        ///        the timer is running.
+        /// @param allocationLatencies
+        ///        (Optional) The histogram which individual allocation latencies
+        ///        should be recorded in.
+        /// @param deallocationLatencies
+        ///        (Optional) The histogram which individual deallocation
+        ///        latencies should be recorded in.
+        /// @param resourceUsage
+        ///        (Optional) The tracker which should measure operating system
+        ///        resource usage while the timer is running.
+        ///
+        BenchmarkContext(std::uint64_t numIterations, PerformanceCounters* performanceCounters = nullptr, LatencyHistogram* allocationLatencies = nullptr,
+            LatencyHistogram* deallocationLatencies = nullptr, ResourceUsageTracker* resourceUsage = nullptr) noexcept;
+
+        /// Starts the benchmark timer, along with the performance counters and
+        /// resource usage tracker if present. If the timer is started and
+        /// stopped more than once in a run, the elapsed time of each period is
+        /// accumulated. This will assert if the timer is already running.
+        ///
+        void StartTimer() noexcept;
+
+        /// Stops the benchmark timer, along with the performance counters and
+        /// resource usage tracker if present. This will assert if the timer is
+        /// not running.
+        ///
+        void StopTimer() noexcept;
+
+        /// Pauses the benchmark timer and performance counters, so that work
+        /// such as per-iteration setup can be excluded from the measurement.
+        /// This is cheaper than stopping the timer, as the resource usage
+        /// tracker keeps running, so it suits pausing inside the measured loop.
+        /// This will assert if the timer is not running.
+        ///
+        void PauseTimer() noexcept;
+
+        /// Resumes the benchmark timer and performance counters after a call
+        /// to PauseTimer(). This will assert if the timer is not paused.
+        ///
+        void ResumeTimer() noexcept;
+
+        /// Attaches a fixture to the context, whose per-iteration setup and
+        /// teardown will be called by the iteration range. This is typically
+        /// handled by RunFixtureBenchmark().
+        ///
+        /// @param fixture
+        ///        The fixture, or null to detach the current fixture.
+        ///
+        void SetFixture(BenchmarkFixture* fixture) noexcept { m_fixture = fixture; }
+
+        /// Sets the logical CPUs that threads started by RunThreads() should be
+        /// pinned to. This is typically handled by the BenchmarkRunner.
+        ///
+        /// @param cpus
+        ///        The CPUs, or null if threads should not be pinned. The list
+        ///        must outlive the context.
+        ///
+        void SetWorkerCpus(const std::vector<std::uint32_t>* cpus) noexcept { m_workerCpus = cpus; }
+
+        /// Sets a cache evictor which is used to evict the CPU caches before
+        /// every given number of iterations of the iteration range, with the
+        /// timer paused. This is typically handled by the BenchmarkRunner.
+        ///
+        /// @param cacheEvictor
+        ///        The evictor, or null to stop evicting.
+        /// @param interval
+        ///        The number of iterations between evictions, or zero to never
+        ///        evict between iterations.
+        ///
+        void SetCacheEvictor(CacheEvictor* cacheEvictor, std::uint64_t interval) noexcept;
+
+        /// @return The total time in nanoseconds spent evicting caches between
+        /// iterations. This is excluded from the elapsed time.
+        ///
+        std::uint64_t GetEvictionTime() const noexcept { return m_evictionTime; }
+
+        /// Makes this the context of a soak benchmark, which runs for the given
+        /// wall-clock duration and records a snapshot every interval. The soak
+        /// starts when this is called. This is typically handled by the
+        /// BenchmarkRunner.
+        ///
+        /// @param duration
+        ///        The wall-clock time in nanoseconds the soak should run for.
+        /// @param snapshotInterval
+        ///        The wall-clock time in nanoseconds between snapshots.
+        ///
+        void SetSoak(std::uint64_t duration, std::uint64_t snapshotInterval) noexcept;
+
+        /// @return Whether or not the soak duration has elapsed. This is always
+        /// true if the context isn't for a soak benchmark.
+        ///
+        bool IsSoakComplete() const noexcept;
+
+        /// @return Whether or not the snapshot interval has elapsed since the
+        /// start of the soak or the last snapshot.
+        ///
+        bool IsSnapshotDue() const noexcept;
+
+        /// Records a snapshot of the soak. The time, throughput since the last
+        /// snapshot and resident set size are filled in by the context, while
+        /// the benchmark provides the state of its allocator. This must be
+        /// called with the timer paused, so that gathering the state is
+        /// excluded from the measurement.
+        ///
+        /// @param numOperations
+        ///        The total number of operations performed since the soak
+        ///        started.
+        /// @param liveBytes
+        ///        The number of bytes allocated and not yet freed.
+        /// @param reservedBytes
+        ///        The number of bytes the allocator has reserved, or zero if
+        ///        unknown.
+        /// @param largestAllocation
+        ///        The largest allocation the allocator could satisfy, or zero if
+        ///        unknown.
+        ///
+        void RecordSnapshot(std::uint64_t numOperations, std::uint64_t liveBytes, std::uint64_t reservedBytes, std::uint64_t largestAllocation) noexcept;
+
+        /// @return The snapshots recorded during the soak, in order.
+        ///
+        const std::vector<SoakSnapshot>& GetSnapshots() const noexcept { return m_snapshots; }
+
+        /// Runs the given work on the given number of threads, timing the whole
+        /// and each thread individually. All threads are spawned and waiting
+        /// before the timer is started, are then released simultaneously, and
+        /// are joined after the timer is stopped, so thread creation and
+        /// teardown are excluded from the measurement. This will assert if the
+        /// timer is already running.
+        ///
+        /// The work must not record latencies, as the histograms are not
+        /// thread-safe. If worker CPUs have been set, the threads are pinned
+        /// to them in turn.
+        ///
+        /// @param numThreads
+        ///        The number of threads. Must be greater than zero.
+        /// @param work
+        ///        The work each thread should perform.
+        ///
+        void RunThreads(std::uint32_t numThreads, const ThreadWork& work) noexcept;
+
+        /// @return The time in nanoseconds spent by each thread in RunThreads(),
+        /// indexed by thread. If RunThreads() was called more than once, times
+        /// are summed. This is empty if the benchmark is single threaded.
+        ///
+        const std::vector<std::uint64_t>& GetThreadTimes() const noexcept { return m_threadTimes; }
+
+        /// @return Whether or not the benchmark timer is currently running.
+        ///
+        bool IsTimerRunning() const noexcept { return m_timer.IsRunning(); }
+
+        /// @return The time in nanoseconds recorded by the benchmark timer, less
+        /// any time excluded with ExcludeTime(). This is clamped at zero.
+        ///
+        std::uint64_t GetElapsedTime() const noexcept;
+
+        /// Excludes the given time from the elapsed time. This is for work which
+        /// can't be paused around without the pause dominating the measurement,
+        /// for example the setup of a very cheap operation: the work and the
+        /// operation are timed together, and the benchmark separately times the
+        /// work alone and excludes it. Performance counters are not corrected.
+        ///
+        /// @param time
+        ///        The time in nanoseconds to exclude.
+        ///
+        void ExcludeTime(std::uint64_t time) noexcept { m_excludedTime += time; }
+
+        /// @return The total time in nanoseconds excluded with ExcludeTime().
+        ///
+        std::uint64_t GetExcludedTime() const noexcept { return m_excludedTime; }
+
+        /// Returns the number of iterations of its inner loop that the benchmark
+        /// should perform. The runner calibrates this so that each run lasts for
+        /// long enough to be measured accurately. Calling this marks the
+        /// benchmark as iteration based; benchmarks that never call it are
+        /// assumed to perform a fixed amount of work and are not calibrated.
+        ///
+        /// @return The number of iterations to perform.
+        ///
+        std::uint64_t GetNumIterations() noexcept;
+
+        /// Returns a range over the number of iterations of its inner loop that
+        /// the benchmark should perform, which calls the per-iteration setup and
+        /// teardown of any attached fixture. Like GetNumIterations(), this marks
+        /// the benchmark as iteration based.
+        ///
+        /// @return The range of iterations.
+        ///
+        IterationRange GetIterations() noexcept { return IterationRange(*this, GetNumIterations()); }
+
+        /// @return Whether or not the benchmark requested the number of
+        /// iterations to perform.
+        ///
+        bool IsIterationBased() const noexcept { return m_iterationBased; }
+
+        /// @return The histogram which individual allocation latencies should be
+        /// recorded in, or null if latencies are not being recorded.
+        ///
+        LatencyHistogram* GetAllocationLatencies() const noexcept { return m_allocationLatencies; }
+
+        /// @return The histogram which individual deallocation latencies should
+        /// be recorded in, or null if latencies are not being recorded.
+        ///
+        LatencyHistogram* GetDeallocationLatencies() const noexcept { return m_deallocationLatencies; }
+
+        /// Sets the number of operations performed by the benchmark. This is
+        /// used to calculate the cost of each individual operation.
+        ///
+        /// @param numOperations
+        ///        The number of operations performed.
+        ///
+        void SetNumOperations(std::uint64_t numOperations) noexcept { m_numOperations = numOperations; }
+
+        /// @return The number of operations performed by the benchmark, or zero
+        /// if the benchmark didn't specify.
+        ///
+        std::uint64_t GetNumOperations() const noexcept { return m_numOperations; }
+
+        /// Sets the total size of all allocations made by the benchmark. This is
+        /// used to report the rate at which memory is allocated, which is not a
+        /// memory bandwidth: the allocated memory usually isn't read or written
+        /// in full.
+        ///
+        /// @param numAllocatedBytes
+        ///        The number of bytes allocated.
+        ///
+        void SetNumAllocatedBytes(std::uint64_t numAllocatedBytes) noexcept { m_numAllocatedBytes = numAllocatedBytes; }
+
+        /// @return The number of bytes allocated by the benchmark, or zero if the
+        /// benchmark didn't specify.
+        ///
+        std::uint64_t GetNumAllocatedBytes() const noexcept { return m_numAllocatedBytes; }
+
+        /// @return The number of times the timer was started or resumed. Each of
+        /// these adds the cost of reading the clock to the elapsed time.
+        ///
+        std::uint64_t GetNumTimerWindows() const noexcept { return m_numTimerWindows; }
+
+        /// Sets the value of a named, benchmark specific counter, for example a
+        /// measure of fragmentation. Counters are reported alongside the timings,
+        /// averaged over all measured runs. Setting a counter that has already
+        /// been set replaces its value.
+        ///
+        /// @param name
+        ///        The name of the counter. This must not contain whitespace.
+        /// @param value
+        ///        The value of the counter for this run.
+        ///
+        void SetCounter(const std::string& name, double value) noexcept { m_counters[name] = value; }
+
+        /// @return The benchmark specific counters set during this run, keyed
+        /// by name.
+        ///
+        const std::map<std::string, double>& GetCounters() const noexcept { return m_counters; }
+
+    private:
+        BenchmarkContext(const BenchmarkContext&) = delete;
+        BenchmarkContext& operator=(const BenchmarkContext&) = delete;
+
+        /// @return The wall-clock time in nanoseconds since the soak started.
+        ///
+        std::uint64_t GetSoakTime() const noexcept;
+
+        /// Calls the per-iteration setup of the attached fixture, with the timer
+        /// paused if it is running.
+        ///
+        /// @param index
+        ///        The index of the iteration.
+        ///
+        void BeginIteration(std::uint64_t index) noexcept;
+
+        /// Calls the per-iteration teardown of the attached fixture, with the
+        /// timer paused if it is running.
+        ///
+        /// @param index
+        ///        The index of the iteration.
+        ///
+        void EndIteration(std::uint64_t index) noexcept;
+
+        Timer m_timer = Timer(false);
+        PerformanceCounters* m_performanceCounters;
+        LatencyHistogram* m_allocationLatencies;
+        LatencyHistogram* m_deallocationLatencies;
+        ResourceUsageTracker* m_resourceUsage;
+        BenchmarkFixture* m_fixture = nullptr;
+        const std::vector<std::uint32_t>* m_workerCpus = nullptr;
+        CacheEvictor* m_cacheEvictor = nullptr;
+        std::uint64_t m_evictionInterval = 0;
+        std::uint64_t m_evictionTime = 0;
+        std::uint64_t m_excludedTime = 0;
+        bool m_paused = false;
+        std::uint64_t m_numIterations;
+        bool m_iterationBased = false;
+        std::uint64_t m_numOperations = 0;
+        std::uint64_t m_numAllocatedBytes = 0;
+        std::uint64_t m_numTimerWindows = 0;
+        std::vector<std::uint64_t> m_threadTimes;
+        std::map<std::string, double> m_counters;
+        std::chrono::steady_clock::time_point m_soakStart;
+        std::uint64_t m_soakDuration = 0;
+        std::uint64_t m_snapshotInterval = 0;
+        std::uint64_t m_snapshotElapsedTime = 0;
+        std::vector<SoakSnapshot> m_snapshots;
+    };
+}
+
+#endif
\ No newline at end of file
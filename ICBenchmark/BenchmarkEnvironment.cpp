@@ -0,0 +1,225 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "BenchmarkEnvironment.h"
+#include "CpuControl.h"
+
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#if defined(_WIN32)
+#include <cstdlib>
+#else
+#include <sys/utsname.h>
+#endif
+
+#define IC_BENCHMARK_STRINGIFY_IMPL(x) #x
+#define IC_BENCHMARK_STRINGIFY(x) IC_BENCHMARK_STRINGIFY_IMPL(x)
+
+namespace IC
+{
+    namespace
+    {
+        /// @return The current UTC time in ISO 8601 format.
+        ///
+        std::string GetTimestamp() noexcept
+        {
+            auto now = std::time(nullptr);
+            std::tm utc;
+#if defined(_WIN32)
+            gmtime_s(&utc, &now);
+#else
+            gmtime_r(&now, &utc);
+#endif
+
+            char buffer[32];
+            std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", &utc);
+            return buffer;
+        }
+
+        /// @return The processor model name, or "unknown".
+        ///
+        std::string GetCpuModel() noexcept
+        {
+#if defined(_WIN32)
+            auto identifier = std::getenv("PROCESSOR_IDENTIFIER");
+            if (identifier)
+            {
+                return identifier;
+            }
+#elif defined(__linux__)
+            std::ifstream cpuInfo("/proc/cpuinfo");
+            std::string line;
+            while (std::getline(cpuInfo, line))
+            {
+                if (line.compare(0, 10, "model name") == 0 || line.compare(0, 9, "Processor") == 0)
+                {
+                    auto separator = line.find(':');
+                    if (separator != std::string::npos && separator + 2 <= line.size())
+                    {
+                        return line.substr(separator + 2);
+                    }
+                }
+            }
+#endif
+            return "unknown";
+        }
+
+        /// @param out_hostName
+        ///        (Out) The name of the host machine.
+        /// @param out_operatingSystem
+        ///        (Out) The name and release of the operating system.
+        ///
+        void GetSystemNames(std::string& out_hostName, std::string& out_operatingSystem) noexcept
+        {
+#if defined(_WIN32)
+            auto computerName = std::getenv("COMPUTERNAME");
+            out_hostName = computerName ? computerName : "unknown";
+            out_operatingSystem = "Windows";
+#else
+            utsname names;
+            if (uname(&names) == 0)
+            {
+                out_hostName = names.nodename;
+                out_operatingSystem = std::string(names.sysname) + " " + names.release + " " + names.machine;
+            }
+            else
+            {
+                out_hostName = "unknown";
+                out_operatingSystem = "unknown";
+            }
+#endif
+        }
+
+        /// @return The compiler name and version.
+        ///
+        std::string GetCompiler() noexcept
+        {
+#if defined(__clang__)
+            return "Clang " __clang_version__;
+#elif defined(__GNUC__)
+            return "GCC " __VERSION__;
+#elif defined(_MSC_VER)
+            return "MSVC " IC_BENCHMARK_STRINGIFY(_MSC_FULL_VER);
+#else
+            return "unknown";
+#endif
+        }
+
+        /// @return The target architecture, build configuration and any
+        /// additional build flags.
+        ///
+        std::string GetBuildFlags() noexcept
+        {
+            std::ostringstream flags;
+
+#if defined(_M_X64) || defined(__x86_64__)
+            flags << "x64";
+#elif defined(_M_IX86) || defined(__i386__)
+            flags << "x86";
+#elif defined(_M_ARM64) || defined(__aarch64__)
+            flags << "arm64";
+#else
+            flags << "unknown-arch";
+#endif
+
+#if defined(NDEBUG)
+            flags << " release";
+#else
+            flags << " debug";
+#endif
+
+#if defined(__OPTIMIZE__)
+            flags << " optimised";
+#endif
+
+#if defined(IC_BENCHMARK_BUILD_FLAGS)
+            flags << " " << IC_BENCHMARK_STRINGIFY(IC_BENCHMARK_BUILD_FLAGS);
+#endif
+
+            return flags.str();
+        }
+
+        /// @param cpus
+        ///        A list of logical CPU indices in ascending order.
+        ///
+        /// @return The list in a compact form, in which consecutive indices are
+        /// written as a range, for example "0-3,6". If the list is empty this
+        /// is "unknown".
+        ///
+        std::string FormatCpuList(const std::vector<std::uint32_t>& cpus) noexcept
+        {
+            if (cpus.empty())
+            {
+                return "unknown";
+            }
+
+            std::ostringstream list;
+            for (std::size_t i = 0; i < cpus.size();)
+            {
+                auto end = i + 1;
+                while (end < cpus.size() && cpus[end] == cpus[end - 1] + 1)
+                {
+                    ++end;
+                }
+
+                list << (i > 0 ? "," : "") << cpus[i];
+                if (end - i > 1)
+                {
+                    list << "-" << cpus[end - 1];
+                }
+
+                i = end;
+            }
+
+            return list.str();
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    BenchmarkEnvironment BenchmarkEnvironment::Detect() noexcept
+    {
+        BenchmarkEnvironment environment;
+        environment.m_timestamp = GetTimestamp();
+        GetSystemNames(environment.m_hostName, environment.m_operatingSystem);
+        environment.m_cpuModel = GetCpuModel();
+        environment.m_numCpus = std::thread::hardware_concurrency();
+        environment.m_compiler = GetCompiler();
+        environment.m_buildFlags = GetBuildFlags();
+
+        auto affinity = CpuControl::GetThreadAffinity();
+        environment.m_cpuAffinity = FormatCpuList(affinity);
+        environment.m_schedulingPolicy = CpuControl::GetSchedulingPolicy();
+        environment.m_frequencyGovernor = CpuControl::GetFrequencyGovernor(affinity.empty() ? 0 : affinity.front());
+        environment.m_turboBoost = CpuControl::GetTurboBoostState();
+
+#if defined(IC_BENCHMARK_GIT_REVISION)
+        environment.m_gitRevision = IC_BENCHMARK_STRINGIFY(IC_BENCHMARK_GIT_REVISION);
+#else
+        environment.m_gitRevision = "unknown";
+#endif
+
+        return environment;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_BENCHMARKENVIRONMENT_H_
+#define _ICBENCHMARK_BENCHMARKENVIRONMENT_H_
+
+#include <cstdint>
+#include <string>
+
+namespace IC
+{
+    /// A description of the machine and build which produced a benchmark
+    /// report. This is recorded alongside the results so that reports taken
+    /// in different environments can be recognised when compared.
+    ///
+    /// The CPU affinity and scheduling policy describe the calling thread, so
+    /// should be detected after any set up by the BenchmarkRunner.
+    ///
+    /// The git revision and build flags can't be determined at run time, so
+    /// are taken from the IC_BENCHMARK_GIT_REVISION and IC_BENCHMARK_BUILD_FLAGS
+    /// preprocessor definitions if the build system provides them.
+    ///
+    struct BenchmarkEnvironment final
+    {
+        /// @return A description of the environment of the running process.
+        ///
+        static BenchmarkEnvironment Detect() noexcept;
+
+        /// The UTC time at which the environment was detected, in ISO 8601
+        /// format.
+        ///
+        std::string m_timestamp;
+
+        /// The name of the host machine.
+        ///
+        std::string m_hostName;
+
+        /// The operating system.
+        ///
+        std::string m_operatingSystem;
+
+        /// The processor model name.
+        ///
+        std::string m_cpuModel;
+
+        /// The number of logical processors.
+        ///
+        std::uint32_t m_numCpus = 0;
+
+        /// The compiler name and version.
+        ///
+        std::string m_compiler;
+
+        /// The target architecture and build configuration, followed by any
+        /// flags supplied with IC_BENCHMARK_BUILD_FLAGS.
+        ///
+        std::string m_buildFlags;
+
+        /// The git revision the benchmark was built from, or "unknown".
+        ///
+        std::string m_gitRevision;
+
+        /// The logical CPUs the main thread may run on, as a comma separated
+        /// list of indices and ranges, or "unknown".
+        ///
+        std::string m_cpuAffinity;
+
+        /// The scheduling policy of the main thread, for example "SCHED_OTHER"
+        /// or "SCHED_FIFO", or "unknown".
+        ///
+        std::string m_schedulingPolicy;
+
+        /// The frequency scaling governor of the first CPU the main thread may
+        /// run on, or "unknown".
+        ///
+        std::string m_frequencyGovernor;
+
+        /// Whether turbo boost is "enabled" or "disabled", or "unknown".
+        ///
+        std::string m_turboBoost;
+    };
+}
+
+#endif
\ No newline at end of file
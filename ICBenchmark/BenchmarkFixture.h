@@ -0,0 +1,141 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_BENCHMARKFIXTURE_H_
+#define _ICBENCHMARK_BENCHMARKFIXTURE_H_
+
+#include "BenchmarkContext.h"
+#include "BenchmarkParameters.h"
+#include "ForwardDeclarations.h"
+
+#include <cassert>
+#include <cstdint>
+
+namespace IC
+{
+    /// A base class for benchmark fixtures, which provide state shared by the
+    /// body of a benchmark along with untimed setup and teardown. SetUp() and
+    /// TearDown() are called before and after every run of the benchmark, and
+    /// SetUpIteration() and TearDownIteration() before and after every
+    /// iteration of the IC_ITERATE() loop, with the timer paused.
+    ///
+    /// Pausing the timer has a small cost, so the per-iteration hooks are only
+    /// called if they are overridden: the default implementations record that
+    /// they aren't and are never called again for that run. Each call still
+    /// adds a timer window, which can dominate a cheap iteration, so fixtures
+    /// whose per-iteration work can be batched should set an iteration
+    /// interval: SetUpIteration() is then only called before the first
+    /// iteration of each interval, and TearDownIteration() after the last.
+    ///
+    /// Fixtures are used via the IC_FIXTUREBENCHMARK() macros declared in
+    /// BenchmarkGroup.h. A new instance is created for every run.
+    ///
+    /// This is not thread-safe.
+    ///
+    class BenchmarkFixture
+    {
+    public:
+        BenchmarkFixture() = default;
+
+        /// Called before each run of the benchmark, outside of the timer.
+        ///
+        /// @param parameters
+        ///        The parameter values of the benchmark, which are empty if it
+        ///        isn't parameterised.
+        ///
+        virtual void SetUp(const BenchmarkParameters& parameters) noexcept;
+
+        /// Called after each run of the benchmark, outside of the timer.
+        ///
+        virtual void TearDown() noexcept;
+
+        /// Called before each interval of iterations of the benchmark, with the
+        /// timer paused.
+        ///
+        virtual void SetUpIteration() noexcept;
+
+        /// Called after each interval of iterations of the benchmark, with the
+        /// timer paused.
+        ///
+        virtual void TearDownIteration() noexcept;
+
+        /// @return Whether or not SetUpIteration() should be called.
+        ///
+        bool HasSetUpIteration() const noexcept { return m_hasSetUpIteration; }
+
+        /// @return Whether or not TearDownIteration() should be called.
+        ///
+        bool HasTearDownIteration() const noexcept { return m_hasTearDownIteration; }
+
+        /// @return The number of iterations between calls to the per-iteration
+        /// setup and teardown.
+        ///
+        std::uint64_t GetIterationInterval() const noexcept { return m_iterationInterval; }
+
+        virtual ~BenchmarkFixture() noexcept {}
+
+    protected:
+        /// Sets the number of iterations between calls to the per-iteration
+        /// setup and teardown. This defaults to one. The teardown is also called
+        /// after the final iteration, even if it ends an interval early.
+        ///
+        /// @param iterationInterval
+        ///        The number of iterations. Must be greater than zero.
+        ///
+        void SetIterationInterval(std::uint64_t iterationInterval) noexcept
+        {
+            assert(iterationInterval > 0);
+            m_iterationInterval = iterationInterval;
+        }
+
+    private:
+        BenchmarkFixture(const BenchmarkFixture&) = delete;
+        BenchmarkFixture& operator=(const BenchmarkFixture&) = delete;
+
+        bool m_hasSetUpIteration = true;
+        bool m_hasTearDownIteration = true;
+        std::uint64_t m_iterationInterval = 1;
+    };
+
+    /// Performs a single run of a fixture benchmark: creates the fixture, sets
+    /// it up, runs the benchmark body with the fixture attached to the context
+    /// and then tears it down.
+    ///
+    /// @param context
+    ///        The context in which the benchmark is executed.
+    /// @param parameters
+    ///        The parameter values of the benchmark.
+    ///
+    template <typename TFixtureBenchmark> void RunFixtureBenchmark(BenchmarkContext& context, const BenchmarkParameters& parameters) noexcept
+    {
+        TFixtureBenchmark fixture;
+        fixture.SetUp(parameters);
+
+        context.SetFixture(&fixture);
+        fixture.RunBenchmark_(context);
+        context.SetFixture(nullptr);
+
+        fixture.TearDown();
+    }
+}
+
+#endif
\ No newline at end of file
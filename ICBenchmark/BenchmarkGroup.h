@@ -27,7 +27,12 @@
 
 #include "AutoRegisterBenchmark.h"
 #include "Benchmark.h"
-#include "Timer.h"
+#include "BenchmarkContext.h"
+#include "BenchmarkFixture.h"
+#include "BenchmarkParameters.h"
+#include "BenchmarkParameterSpace.h"
+#include "LatencyProbe.h"
+#include "OptimisationBarrier.h"
 
 /// Declares a new benchmark group.
 ///
@@ -47,21 +52,233 @@
 ///        The name of the benchmark.
 ///
 #define IC_BENCHMARK(benchmarkName) \
-    void benchmarkName##Benchmark_(IC::Timer& timer_) noexcept; \
+    void benchmarkName##Benchmark_(IC::BenchmarkContext& context_) noexcept; \
     namespace \
     { \
         const IC::AutoRegisterBenchmark benchmarkName##AutoReg(IC::Benchmark(k_benchmarkGroupName_, #benchmarkName, benchmarkName##Benchmark_)); \
     } \
-    void benchmarkName##Benchmark_(IC::Timer& timer_) noexcept
+    void benchmarkName##Benchmark_(IC::BenchmarkContext& context_) noexcept
+
+/// Declares a new parameterised benchmark within a benchmark group. One
+/// instance of the benchmark is registered for each combination of values in
+/// the given parameter space, named after the benchmark followed by its
+/// parameter values. The value of each parameter can be read within the
+/// benchmark using IC_PARAMETER().
+///
+/// @param benchmarkName
+///        The name of the benchmark.
+/// @param ...
+///        An expression evaluating to the IC::BenchmarkParameterSpace.
+///
+#define IC_PARAMETERISEDBENCHMARK(benchmarkName, ...) \
+    void benchmarkName##Benchmark_(IC::BenchmarkContext& context_, const IC::BenchmarkParameters& parameters_) noexcept; \
+    namespace \
+    { \
+        const IC::AutoRegisterBenchmark benchmarkName##AutoReg(k_benchmarkGroupName_, #benchmarkName, __VA_ARGS__, benchmarkName##Benchmark_); \
+    } \
+    void benchmarkName##Benchmark_(IC::BenchmarkContext& context_, const IC::BenchmarkParameters& parameters_) noexcept
+
+/// Evaluates to the value of the named parameter of a parameterised
+/// benchmark. This must be called within a benchmark declared with
+/// IC_PARAMETERISEDBENCHMARK().
+///
+/// @param parameterName
+///        The name of the parameter.
+///
+#define IC_PARAMETER(parameterName) \
+    parameters_.Get(#parameterName)
+
+/// Declares a new benchmark within a benchmark group which uses the given
+/// fixture. The body of the benchmark is a member of a class derived from the
+/// fixture, so has direct access to its protected and public members.
+///
+/// @param fixtureType
+///        The fixture type, which must derive from IC::BenchmarkFixture.
+/// @param benchmarkName
+///        The name of the benchmark.
+///
+#define IC_FIXTUREBENCHMARK(fixtureType, benchmarkName) \
+    struct benchmarkName##Fixture_ final : public fixtureType \
+    { \
+        void RunBenchmark_(IC::BenchmarkContext& context_) noexcept; \
+    }; \
+    namespace \
+    { \
+        const IC::AutoRegisterBenchmark benchmarkName##AutoReg(IC::Benchmark(k_benchmarkGroupName_, #benchmarkName, \
+            [](IC::BenchmarkContext& context) noexcept { IC::RunFixtureBenchmark<benchmarkName##Fixture_>(context, IC::BenchmarkParameters()); })); \
+    } \
+    void benchmarkName##Fixture_::RunBenchmark_(IC::BenchmarkContext& context_) noexcept
+
+/// Declares a new parameterised benchmark within a benchmark group which uses
+/// the given fixture. The parameter values are passed to the fixture's
+/// SetUp(), and can also be read within the benchmark using IC_PARAMETER().
+///
+/// @param fixtureType
+///        The fixture type, which must derive from IC::BenchmarkFixture.
+/// @param benchmarkName
+///        The name of the benchmark.
+/// @param ...
+///        An expression evaluating to the IC::BenchmarkParameterSpace.
+///
+#define IC_PARAMETERISEDFIXTUREBENCHMARK(fixtureType, benchmarkName, ...) \
+    struct benchmarkName##Fixture_ final : public fixtureType \
+    { \
+        void RunBenchmark_(IC::BenchmarkContext& context_) noexcept; \
+        void SetUp(const IC::BenchmarkParameters& parameters) noexcept override \
+        { \
+            parameters_ = parameters; \
+            fixtureType::SetUp(parameters); \
+        } \
+        IC::BenchmarkParameters parameters_; \
+    }; \
+    namespace \
+    { \
+        const IC::AutoRegisterBenchmark benchmarkName##AutoReg(k_benchmarkGroupName_, #benchmarkName, __VA_ARGS__, IC::RunFixtureBenchmark<benchmarkName##Fixture_>); \
+    } \
+    void benchmarkName##Fixture_::RunBenchmark_(IC::BenchmarkContext& context_) noexcept
 
 /// Starts the timer within a benchmark. This must be called within a benchmark.
 ///
 #define IC_STARTTIMER() \
-    timer_.Start();
+    context_.StartTimer();
 
 /// Stops the timer within a benchmark. This must be called within a benchmark.
 ///
 #define IC_STOPTIMER() \
-    timer_.Stop();
+    context_.StopTimer();
+
+/// Pauses the timer within a benchmark, so that work can be excluded from the
+/// measurement. This must be called within a benchmark, while the timer is
+/// running.
+///
+#define IC_PAUSETIMER() \
+    context_.PauseTimer();
+
+/// Resumes the timer within a benchmark after IC_PAUSETIMER(). This must be
+/// called within a benchmark.
+///
+#define IC_RESUMETIMER() \
+    context_.ResumeTimer();
+
+/// Excludes the given time from the measurement, for work that was timed
+/// along with the operation being measured but was also timed separately.
+/// This must be called within a benchmark.
+///
+/// @param time
+///        The time in nanoseconds to exclude.
+///
+#define IC_EXCLUDETIME(time) \
+    context_.ExcludeTime(time);
+
+/// Runs the given work concurrently on the given number of threads, timing
+/// the whole and each thread individually. The threads are all created before
+/// the timer starts and released from a barrier simultaneously. This must be
+/// called within a benchmark, and the timer must not already be running.
+///
+/// @param numThreads
+///        The number of threads.
+/// @param ...
+///        The work performed by each thread, a function taking the thread
+///        index.
+///
+#define IC_RUNTHREADS(numThreads, ...) \
+    context_.RunThreads(static_cast<std::uint32_t>(numThreads), __VA_ARGS__);
+
+/// Evaluates to the number of iterations of its inner loop that the benchmark
+/// should perform, as calibrated by the runner. This must be called within a
+/// benchmark.
+///
+#define IC_NUMITERATIONS() \
+    context_.GetNumIterations()
+
+/// Declares a loop which performs the calibrated number of iterations. The
+/// loop body should contain the work being measured. In a fixture benchmark
+/// the fixture's per-iteration setup and teardown are called around each
+/// interval of iterations with the timer paused. This must be called within a benchmark.
+///
+#define IC_ITERATE() \
+    for (auto iteration_ : context_.GetIterations())
+
+/// Evaluates the given allocation expression, recording how long it took in
+/// the allocation latency histogram if latencies are being recorded. The
+/// result of the expression is returned. This must be called within a
+/// benchmark.
+///
+/// @param expression
+///        The expression which performs a single allocation.
+///
+#define IC_TIMEALLOCATION(expression) \
+    (IC::LatencyProbe(context_.GetAllocationLatencies()), expression)
+
+/// Evaluates the given deallocation expression, recording how long it took in
+/// the deallocation latency histogram if latencies are being recorded. This
+/// must be called within a benchmark.
+///
+/// @param expression
+///        The expression which performs a single deallocation.
+///
+#define IC_TIMEDEALLOCATION(expression) \
+    (IC::LatencyProbe(context_.GetDeallocationLatencies()), expression)
+
+/// Sets the number of operations, for example allocations, performed by the
+/// benchmark. This is used to report the cost of each individual operation.
+/// This must be called within a benchmark.
+///
+/// @param numOperations
+///        The number of operations performed.
+///
+#define IC_SETNUMOPERATIONS(numOperations) \
+    context_.SetNumOperations(numOperations);
+
+/// Sets the total size of all allocations made by the benchmark. This is used
+/// to report the rate at which memory is allocated, so should only be set by
+/// benchmarks which allocate. This must be called within a benchmark.
+///
+/// @param numAllocatedBytes
+///        The number of bytes allocated.
+///
+#define IC_SETNUMALLOCATEDBYTES(numAllocatedBytes) \
+    context_.SetNumAllocatedBytes(numAllocatedBytes);
+
+/// Evaluates to whether or not the soak duration has elapsed, which is always
+/// true outside of a soak benchmark. This must be called within a benchmark.
+///
+#define IC_SOAKCOMPLETE() \
+    context_.IsSoakComplete()
+
+/// Evaluates to whether or not it is time for a soak benchmark to record a
+/// snapshot. This must be called within a benchmark.
+///
+#define IC_SNAPSHOTDUE() \
+    context_.IsSnapshotDue()
+
+/// Records a snapshot of a soak benchmark. The time, throughput and resident
+/// set size are filled in automatically. This must be called within a
+/// benchmark, with the timer paused or stopped.
+///
+/// @param numOperations
+///        The total number of operations performed so far.
+/// @param liveBytes
+///        The number of bytes allocated and not yet freed.
+/// @param reservedBytes
+///        The number of bytes reserved by the allocator, or zero if unknown.
+/// @param largestAllocation
+///        The largest allocation the allocator could satisfy, or zero if
+///        unknown.
+///
+#define IC_RECORDSNAPSHOT(numOperations, liveBytes, reservedBytes, largestAllocation) \
+    context_.RecordSnapshot(numOperations, liveBytes, reservedBytes, largestAllocation);
+
+/// Sets the value of a named, benchmark specific counter, which is reported
+/// alongside the timings and averaged over all measured runs. This must be
+/// called within a benchmark.
+///
+/// @param name
+///        The name of the counter, which must not contain whitespace.
+/// @param value
+///        The value of the counter.
+///
+#define IC_SETCOUNTER(name, value) \
+    context_.SetCounter(name, static_cast<double>(value));
 
 #endif
\ No newline at end of file
@@ -0,0 +1,304 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "BenchmarkMeasurement.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+namespace IC
+{
+    namespace
+    {
+        /// Writes the non-empty buckets of the given histogram to the stream.
+        ///
+        /// @param histogram
+        ///        The histogram.
+        /// @param stream
+        ///        The output stream.
+        ///
+        void SerialiseHistogram(const LatencyHistogram& histogram, std::ostream& stream) noexcept
+        {
+            const auto& buckets = histogram.GetBuckets();
+
+            std::size_t numNonEmpty = 0;
+            for (auto count : buckets)
+            {
+                numNonEmpty += (count > 0) ? 1 : 0;
+            }
+
+            stream << histogram.GetMax() << " " << numNonEmpty;
+            for (std::size_t i = 0; i < buckets.size(); ++i)
+            {
+                if (buckets[i] > 0)
+                {
+                    stream << " " << i << " " << buckets[i];
+                }
+            }
+            stream << "\n";
+        }
+
+        /// Reads a histogram written with SerialiseHistogram().
+        ///
+        /// @param stream
+        ///        The input stream.
+        /// @param out_histogram
+        ///        (Out) The histogram.
+        ///
+        /// @return Whether or not a valid histogram was read.
+        ///
+        bool DeserialiseHistogram(std::istream& stream, LatencyHistogram& out_histogram) noexcept
+        {
+            std::uint64_t max = 0;
+            std::size_t numNonEmpty = 0;
+            if (!(stream >> max >> numNonEmpty))
+            {
+                return false;
+            }
+
+            auto buckets = LatencyHistogram().GetBuckets();
+            for (std::size_t i = 0; i < numNonEmpty; ++i)
+            {
+                std::size_t index = 0;
+                std::uint64_t count = 0;
+                if (!(stream >> index >> count) || index >= buckets.size())
+                {
+                    return false;
+                }
+
+                buckets[index] = count;
+            }
+
+            return out_histogram.SetBuckets(buckets, max);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    void BenchmarkMeasurement::Merge(const BenchmarkMeasurement& other) noexcept
+    {
+        if (m_samples.empty())
+        {
+            *this = other;
+            return;
+        }
+
+        assert(m_numIterations == other.m_numIterations);
+
+        m_numOperations = other.m_numOperations;
+        m_numAllocatedBytes = other.m_numAllocatedBytes;
+        m_numTimerWindows = other.m_numTimerWindows;
+        m_samples.insert(m_samples.end(), other.m_samples.begin(), other.m_samples.end());
+
+        std::array<std::uint64_t, PerformanceCounterValues::k_numCounters> values;
+        std::array<bool, PerformanceCounterValues::k_numCounters> available;
+        std::array<std::uint64_t, PerformanceCounterValues::k_numCounters> timesEnabled;
+        std::array<std::uint64_t, PerformanceCounterValues::k_numCounters> timesRunning;
+        for (std::size_t i = 0; i < PerformanceCounterValues::k_numCounters; ++i)
+        {
+            auto counter = static_cast<PerformanceCounter>(i);
+            available[i] = m_performanceCounters.IsAvailable(counter) && other.m_performanceCounters.IsAvailable(counter);
+            values[i] = available[i] ? m_performanceCounters.GetValue(counter) + other.m_performanceCounters.GetValue(counter) : 0;
+            timesEnabled[i] = m_performanceCounters.GetTimeEnabled(counter) + other.m_performanceCounters.GetTimeEnabled(counter);
+            timesRunning[i] = m_performanceCounters.GetTimeRunning(counter) + other.m_performanceCounters.GetTimeRunning(counter);
+        }
+        m_performanceCounters = PerformanceCounterValues(values, available, timesEnabled, timesRunning);
+
+        m_allocationLatencies.Merge(other.m_allocationLatencies);
+        m_deallocationLatencies.Merge(other.m_deallocationLatencies);
+        m_resourceUsage.Merge(other.m_resourceUsage);
+
+        m_threadTimes.resize(std::max(m_threadTimes.size(), other.m_threadTimes.size()), 0);
+        for (std::size_t i = 0; i < other.m_threadTimes.size(); ++i)
+        {
+            m_threadTimes[i] += other.m_threadTimes[i];
+        }
+
+        for (const auto& counter : other.m_counters)
+        {
+            m_counters[counter.first] += counter.second;
+        }
+
+        m_snapshots.insert(m_snapshots.end(), other.m_snapshots.begin(), other.m_snapshots.end());
+    }
+
+    //------------------------------------------------------------------------------
+    std::string BenchmarkMeasurement::Serialise() const noexcept
+    {
+        std::ostringstream stream;
+
+        stream << m_numIterations << " " << m_numOperations << " " << m_numAllocatedBytes << " " << m_numTimerWindows << "\n";
+
+        stream << m_samples.size();
+        for (auto sample : m_samples)
+        {
+            stream << " " << sample;
+        }
+        stream << "\n";
+
+        for (std::size_t i = 0; i < PerformanceCounterValues::k_numCounters; ++i)
+        {
+            auto counter = static_cast<PerformanceCounter>(i);
+            stream << (m_performanceCounters.IsAvailable(counter) ? 1 : 0) << " " << m_performanceCounters.GetValue(counter) << " " << m_performanceCounters.GetTimeEnabled(counter) << " "
+                << m_performanceCounters.GetTimeRunning(counter) << " ";
+        }
+        stream << "\n";
+
+        SerialiseHistogram(m_allocationLatencies, stream);
+        SerialiseHistogram(m_deallocationLatencies, stream);
+
+        const auto& usage = m_resourceUsage;
+        stream << (usage.m_available ? 1 : 0) << " " << usage.m_numWindows << " " << usage.m_userTime << " " << usage.m_systemTime << " " << usage.m_minorPageFaults << " "
+            << usage.m_majorPageFaults << " " << usage.m_voluntaryContextSwitches << " " << usage.m_involuntaryContextSwitches << " " << usage.m_peakResidentGrowth << " "
+            << usage.m_retainedResidentGrowth << "\n";
+
+        stream << m_threadTimes.size();
+        for (auto threadTime : m_threadTimes)
+        {
+            stream << " " << threadTime;
+        }
+        stream << "\n";
+
+        stream << std::setprecision(std::numeric_limits<double>::max_digits10) << m_counters.size();
+        for (const auto& counter : m_counters)
+        {
+            stream << " " << counter.first << " " << counter.second;
+        }
+        stream << "\n";
+
+        stream << m_snapshots.size() << "\n";
+        for (const auto& snapshot : m_snapshots)
+        {
+            stream << snapshot.m_time << " " << snapshot.m_numOperations << " " << snapshot.m_operationsPerSecond << " " << snapshot.m_liveBytes << " "
+                << snapshot.m_reservedBytes << " " << snapshot.m_largestAllocation << " " << snapshot.m_residentBytes << "\n";
+        }
+
+        return stream.str();
+    }
+
+    //------------------------------------------------------------------------------
+    bool BenchmarkMeasurement::Deserialise(const std::string& serialised) noexcept
+    {
+        std::istringstream stream(serialised);
+        BenchmarkMeasurement measurement;
+
+        std::size_t numSamples = 0;
+        if (!(stream >> measurement.m_numIterations >> measurement.m_numOperations >> measurement.m_numAllocatedBytes >> measurement.m_numTimerWindows >> numSamples))
+        {
+            return false;
+        }
+
+        measurement.m_samples.resize(numSamples);
+        for (auto& sample : measurement.m_samples)
+        {
+            if (!(stream >> sample))
+            {
+                return false;
+            }
+        }
+
+        std::array<std::uint64_t, PerformanceCounterValues::k_numCounters> values;
+        std::array<bool, PerformanceCounterValues::k_numCounters> available;
+        std::array<std::uint64_t, PerformanceCounterValues::k_numCounters> timesEnabled;
+        std::array<std::uint64_t, PerformanceCounterValues::k_numCounters> timesRunning;
+        for (std::size_t i = 0; i < PerformanceCounterValues::k_numCounters; ++i)
+        {
+            int isAvailable = 0;
+            if (!(stream >> isAvailable >> values[i] >> timesEnabled[i] >> timesRunning[i]))
+            {
+                return false;
+            }
+
+            available[i] = (isAvailable != 0);
+        }
+        measurement.m_performanceCounters = PerformanceCounterValues(values, available, timesEnabled, timesRunning);
+
+        if (!DeserialiseHistogram(stream, measurement.m_allocationLatencies) || !DeserialiseHistogram(stream, measurement.m_deallocationLatencies))
+        {
+            return false;
+        }
+
+        auto& usage = measurement.m_resourceUsage;
+        int usageAvailable = 0;
+        if (!(stream >> usageAvailable >> usage.m_numWindows >> usage.m_userTime >> usage.m_systemTime >> usage.m_minorPageFaults >> usage.m_majorPageFaults
+            >> usage.m_voluntaryContextSwitches >> usage.m_involuntaryContextSwitches >> usage.m_peakResidentGrowth >> usage.m_retainedResidentGrowth))
+        {
+            return false;
+        }
+        usage.m_available = (usageAvailable != 0);
+
+        std::size_t numThreads = 0;
+        if (!(stream >> numThreads))
+        {
+            return false;
+        }
+
+        measurement.m_threadTimes.resize(numThreads);
+        for (auto& threadTime : measurement.m_threadTimes)
+        {
+            if (!(stream >> threadTime))
+            {
+                return false;
+            }
+        }
+
+        std::size_t numCounters = 0;
+        if (!(stream >> numCounters))
+        {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < numCounters; ++i)
+        {
+            std::string name;
+            double value = 0.0;
+            if (!(stream >> name >> value))
+            {
+                return false;
+            }
+
+            measurement.m_counters[name] = value;
+        }
+
+        std::size_t numSnapshots = 0;
+        if (!(stream >> numSnapshots))
+        {
+            return false;
+        }
+
+        measurement.m_snapshots.resize(numSnapshots);
+        for (auto& snapshot : measurement.m_snapshots)
+        {
+            if (!(stream >> snapshot.m_time >> snapshot.m_numOperations >> snapshot.m_operationsPerSecond >> snapshot.m_liveBytes >> snapshot.m_reservedBytes
+                >> snapshot.m_largestAllocation >> snapshot.m_residentBytes))
+            {
+                return false;
+            }
+        }
+
+        *this = measurement;
+        return true;
+    }
+}
\ No newline at end of file
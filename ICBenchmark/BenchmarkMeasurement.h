@@ -0,0 +1,126 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_BENCHMARKMEASUREMENT_H_
+#define _ICBENCHMARK_BENCHMARKMEASUREMENT_H_
+
+#include "LatencyHistogram.h"
+#include "PerformanceCounters.h"
+#include "ResourceUsage.h"
+#include "SoakSnapshot.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace IC
+{
+    /// The raw data measured over one or more runs of a single benchmark. This
+    /// is accumulated by the BenchmarkRunner and used to build the benchmark's
+    /// entry in the BenchmarkReport.
+    ///
+    /// Measurements can be serialised so that they can be taken in a child
+    /// process and sent back to the runner, and merged so that measurements
+    /// taken in separate processes can be combined.
+    ///
+    /// This is not thread-safe.
+    ///
+    struct BenchmarkMeasurement final
+    {
+        /// The number of iterations performed by each run.
+        ///
+        std::uint64_t m_numIterations = 0;
+
+        /// The number of operations performed by each run, or zero if unknown.
+        ///
+        std::uint64_t m_numOperations = 0;
+
+        /// The number of bytes allocated by each run, or zero if unknown.
+        ///
+        std::uint64_t m_numAllocatedBytes = 0;
+
+        /// The number of times the timer was started or resumed in each run.
+        ///
+        std::uint64_t m_numTimerWindows = 0;
+
+        /// The time in nanoseconds taken by each measured run.
+        ///
+        std::vector<std::uint64_t> m_samples;
+
+        /// The performance counter values accumulated over all measured runs.
+        ///
+        PerformanceCounterValues m_performanceCounters;
+
+        /// The latencies, in CycleClock ticks, of individual allocations.
+        ///
+        LatencyHistogram m_allocationLatencies;
+
+        /// The latencies, in CycleClock ticks, of individual deallocations.
+        ///
+        LatencyHistogram m_deallocationLatencies;
+
+        /// The operating system resources used over all measured runs.
+        ///
+        ResourceUsage m_resourceUsage;
+
+        /// The time in nanoseconds spent by each thread of a multi-threaded
+        /// benchmark, indexed by thread and summed over all measured runs. This
+        /// is empty for single threaded benchmarks.
+        ///
+        std::vector<std::uint64_t> m_threadTimes;
+
+        /// The benchmark specific counters, keyed by name and summed over all
+        /// measured runs.
+        ///
+        std::map<std::string, double> m_counters;
+
+        /// The snapshots recorded by a soak benchmark, in order. This is empty
+        /// for other benchmarks.
+        ///
+        std::vector<SoakSnapshot> m_snapshots;
+
+        /// Adds the runs described by the given measurement to this one. Both
+        /// measurements must have been taken with the same number of iterations.
+        ///
+        /// @param other
+        ///        The measurement to merge.
+        ///
+        void Merge(const BenchmarkMeasurement& other) noexcept;
+
+        /// @return The measurement serialised to a string.
+        ///
+        std::string Serialise() const noexcept;
+
+        /// Replaces the contents of this measurement with that described by the
+        /// given string, previously created with Serialise().
+        ///
+        /// @param serialised
+        ///        The serialised measurement.
+        ///
+        /// @return Whether or not the string was a valid measurement.
+        ///
+        bool Deserialise(const std::string& serialised) noexcept;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,174 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_BENCHMARKOPTIONS_H_
+#define _ICBENCHMARK_BENCHMARKOPTIONS_H_
+
+#include <cstdint>
+#include <vector>
+
+namespace IC
+{
+    /// Describes whether benchmarks are run in separate processes, so that
+    /// heap state left behind by one benchmark can't affect the next.
+    ///
+    enum class BenchmarkIsolation
+    {
+        k_none,
+        k_perBenchmark,
+        k_perRepetition
+    };
+
+    /// Describes what, if anything, is evicted between timed iterations when
+    /// measuring benchmarks with cold caches.
+    ///
+    enum class CacheEviction
+    {
+        k_none,
+        k_caches,
+        k_cachesAndTlb
+    };
+
+    /// Describes how the BenchmarkRunner should execute the registered
+    /// benchmarks. The defaults are suitable for most uses.
+    ///
+    struct BenchmarkOptions final
+    {
+        /// The number of times each benchmark is run before measurement begins.
+        /// The results of these runs are discarded; they only serve to warm up
+        /// caches, the heap and the CPU clock.
+        ///
+        std::uint32_t m_numWarmupRuns = 1;
+
+        /// The number of measured runs performed for each benchmark. The report
+        /// contains statistics calculated from these samples. Must be at least 1.
+        ///
+        std::uint32_t m_numRepetitions = 10;
+
+        /// The minimum time in nanoseconds that a single run of an iteration based
+        /// benchmark should take. Before any runs are measured the number of
+        /// iterations is grown until a run takes at least this long.
+        ///
+        std::uint64_t m_minRunTime = 100000000;
+
+        /// The upper limit on the number of iterations chosen during calibration.
+        ///
+        std::uint64_t m_maxIterations = 1000000000;
+
+        /// Whether or not the hardware performance counters should be recorded
+        /// while the timer is running in measured runs. Counters which are not
+        /// available on the system are omitted from the report.
+        ///
+        bool m_recordPerformanceCounters = false;
+
+        /// Whether or not the latency of each individual allocation and
+        /// deallocation should be recorded in measured runs. Only operations
+        /// wrapped in IC_TIMEALLOCATION() or IC_TIMEDEALLOCATION() are recorded.
+        /// This adds a small overhead to every operation, so the times taken by
+        /// whole runs are slightly inflated while enabled.
+        ///
+        bool m_recordLatencies = false;
+
+        /// Whether benchmarks should be run in forked child processes. With
+        /// k_perBenchmark each benchmark runs in its own child; with
+        /// k_perRepetition calibration and each measured run (preceded by its
+        /// warmup runs) get their own child. A crash or timeout in a child is
+        /// reported as a failure of that benchmark rather than ending the run.
+        /// This is ignored on platforms which don't support it.
+        ///
+        BenchmarkIsolation m_isolation = BenchmarkIsolation::k_none;
+
+        /// The maximum time in seconds that an isolated child process may run
+        /// for before it is killed, or zero for no limit.
+        ///
+        std::uint32_t m_timeoutSeconds = 600;
+
+        /// The logical CPUs benchmarks should be pinned to, or empty to let the
+        /// operating system schedule them freely. The main thread is pinned to
+        /// the first CPU, and the worker threads of multi-threaded benchmarks
+        /// are assigned to the listed CPUs in turn. This is ignored on
+        /// platforms which don't support it.
+        ///
+        std::vector<std::uint32_t> m_cpus;
+
+        /// Whether the SCHED_FIFO real-time scheduling policy should be
+        /// requested, so that benchmarks aren't preempted by other processes.
+        /// This usually requires elevated privileges; if it can't be set the
+        /// benchmarks run with the default policy, which is recorded in the
+        /// report environment.
+        ///
+        bool m_realtimePriority = false;
+
+        /// Whether the measured runs of the benchmarks within a group should be
+        /// interleaved. If so, each benchmark in the group is calibrated and
+        /// then the repetitions are performed in rounds, with one measured run
+        /// of every benchmark per round in a shuffled order, and each measured
+        /// run is preceded by its own warmup runs. This spreads slow drift in
+        /// machine performance evenly across the benchmarks being compared.
+        /// Otherwise each benchmark is run to completion before the next. This
+        /// is ignored when isolating each benchmark in its own process.
+        ///
+        bool m_interleave = true;
+
+        /// The seed for the shuffled order of interleaved runs. The same seed
+        /// gives the same order on every platform.
+        ///
+        std::uint32_t m_seed = 1;
+
+        /// Whether the measured overhead of the harness should be subtracted
+        /// from every sample: the cost of each timer window, plus the cost of
+        /// an empty iteration for each iteration performed. The overhead is
+        /// recorded in the report either way.
+        ///
+        bool m_subtractOverhead = false;
+
+        /// Whether every benchmark should also be run with cold caches. If so,
+        /// a "/cold" variant of each benchmark is run alongside it, which
+        /// evicts the CPU caches (and optionally the TLB) before each run and
+        /// every m_evictionInterval iterations, with the timer paused. The
+        /// time spent evicting counts towards the minimum run time during
+        /// calibration, so cold runs perform far fewer iterations.
+        ///
+        CacheEviction m_cacheEviction = CacheEviction::k_none;
+
+        /// The number of iterations between evictions in cold variants, or
+        /// zero to evict only before each run. Evicting every iteration gives
+        /// the coldest results, while larger batches amortise the cost of
+        /// pausing the timer.
+        ///
+        std::uint64_t m_evictionInterval = 1;
+
+        /// The wall-clock time in nanoseconds each soak benchmark should run
+        /// for, or zero to run the ordinary benchmarks instead. In soak mode
+        /// only the soak benchmarks are run, each once with no warmup, and
+        /// the isolation timeout is extended by the duration.
+        ///
+        std::uint64_t m_soakDuration = 0;
+
+        /// The wall-clock time in nanoseconds between the snapshots recorded by
+        /// soak benchmarks.
+        ///
+        std::uint64_t m_snapshotInterval = 60000000000;
+    };
+}
+
+#endif
\ No newline at end of file
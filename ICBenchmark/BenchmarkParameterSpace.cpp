@@ -0,0 +1,89 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "BenchmarkParameterSpace.h"
+
+#include <cassert>
+
+namespace IC
+{
+    //------------------------------------------------------------------------------
+    BenchmarkParameterSpace& BenchmarkParameterSpace::Range(const std::string& name, std::uint64_t min, std::uint64_t max, std::uint64_t multiplier) noexcept
+    {
+        assert(min > 0);
+        assert(min <= max);
+        assert(multiplier >= 2);
+
+        std::vector<std::uint64_t> values;
+        for (auto value = min; value < max; value *= multiplier)
+        {
+            values.push_back(value);
+
+            if (value > max / multiplier)
+            {
+                break;
+            }
+        }
+        values.push_back(max);
+
+        m_dimensions.emplace_back(name, values);
+        return *this;
+    }
+
+    //------------------------------------------------------------------------------
+    BenchmarkParameterSpace& BenchmarkParameterSpace::Values(const std::string& name, std::initializer_list<std::uint64_t> values) noexcept
+    {
+        assert(values.size() > 0);
+
+        m_dimensions.emplace_back(name, std::vector<std::uint64_t>(values));
+        return *this;
+    }
+
+    //------------------------------------------------------------------------------
+    std::vector<BenchmarkParameters> BenchmarkParameterSpace::GetCombinations() const noexcept
+    {
+        std::vector<std::vector<BenchmarkParameters::Parameter>> combinations(1);
+
+        for (const auto& dimension : m_dimensions)
+        {
+            std::vector<std::vector<BenchmarkParameters::Parameter>> extended;
+            for (const auto& combination : combinations)
+            {
+                for (auto value : dimension.second)
+                {
+                    extended.push_back(combination);
+                    extended.back().emplace_back(dimension.first, value);
+                }
+            }
+
+            combinations = std::move(extended);
+        }
+
+        std::vector<BenchmarkParameters> parameters;
+        for (const auto& combination : combinations)
+        {
+            parameters.push_back(BenchmarkParameters(combination));
+        }
+
+        return parameters;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_BENCHMARKPARAMETERSPACE_H_
+#define _ICBENCHMARK_BENCHMARKPARAMETERSPACE_H_
+
+#include "BenchmarkParameters.h"
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace IC
+{
+    /// Describes the set of values each parameter of a parameterised benchmark
+    /// can take. One instance of the benchmark is registered for every
+    /// combination of values. Spaces are built by chaining calls, for example:
+    ///
+    ///     IC::BenchmarkParameterSpace().Range("size", 8, 64 * 1024 * 1024).Values("numBlocks", { 4, 64 })
+    ///
+    /// This is not thread-safe.
+    ///
+    class BenchmarkParameterSpace final
+    {
+    public:
+        BenchmarkParameterSpace() = default;
+
+        /// Adds a parameter which takes geometrically increasing values from
+        /// min to max inclusive. The max is always included, even if it is not
+        /// reached exactly.
+        ///
+        /// @param name
+        ///        The name of the parameter.
+        /// @param min
+        ///        The first value. Must be greater than zero.
+        /// @param max
+        ///        The last value. Must be no less than min.
+        /// @param multiplier
+        ///        The factor between consecutive values. Must be at least two.
+        ///
+        /// @return This parameter space, so that calls can be chained.
+        ///
+        BenchmarkParameterSpace& Range(const std::string& name, std::uint64_t min, std::uint64_t max, std::uint64_t multiplier = 2) noexcept;
+
+        /// Adds a parameter which takes each of the given values in turn.
+        ///
+        /// @param name
+        ///        The name of the parameter.
+        /// @param values
+        ///        The values. Must not be empty.
+        ///
+        /// @return This parameter space, so that calls can be chained.
+        ///
+        BenchmarkParameterSpace& Values(const std::string& name, std::initializer_list<std::uint64_t> values) noexcept;
+
+        /// @return Every combination of parameter values, with the last declared
+        /// parameter varying fastest.
+        ///
+        std::vector<BenchmarkParameters> GetCombinations() const noexcept;
+
+    private:
+        std::vector<std::pair<std::string, std::vector<std::uint64_t>>> m_dimensions;
+    };
+}
+
+#endif
\ No newline at end of file
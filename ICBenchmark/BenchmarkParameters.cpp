@@ -0,0 +1,61 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "BenchmarkParameters.h"
+
+#include <cassert>
+
+namespace IC
+{
+    //------------------------------------------------------------------------------
+    BenchmarkParameters::BenchmarkParameters(const std::vector<Parameter>& parameters) noexcept
+        : m_parameters(parameters)
+    {
+    }
+
+    //------------------------------------------------------------------------------
+    std::uint64_t BenchmarkParameters::Get(const std::string& name) const noexcept
+    {
+        for (const auto& parameter : m_parameters)
+        {
+            if (parameter.first == name)
+            {
+                return parameter.second;
+            }
+        }
+
+        assert(false);
+        return 0;
+    }
+
+    //------------------------------------------------------------------------------
+    std::string BenchmarkParameters::ToString() const noexcept
+    {
+        std::string description;
+        for (const auto& parameter : m_parameters)
+        {
+            description += "/" + parameter.first + ":" + std::to_string(parameter.second);
+        }
+
+        return description;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_BENCHMARKPARAMETERS_H_
+#define _ICBENCHMARK_BENCHMARKPARAMETERS_H_
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace IC
+{
+    /// A single combination of named parameter values, passed to one instance
+    /// of a parameterised benchmark. Parameters are stored in the order they
+    /// were declared in the BenchmarkParameterSpace.
+    ///
+    /// This is immutable and therefore thread-safe.
+    ///
+    class BenchmarkParameters final
+    {
+    public:
+        /// A named parameter value.
+        ///
+        using Parameter = std::pair<std::string, std::uint64_t>;
+
+        BenchmarkParameters() = default;
+
+        /// Creates a new instance with the given parameter values.
+        ///
+        /// @param parameters
+        ///        The named parameter values.
+        ///
+        BenchmarkParameters(const std::vector<Parameter>& parameters) noexcept;
+
+        /// Returns the value of the parameter with the given name. This will
+        /// assert if there is no such parameter.
+        ///
+        /// @param name
+        ///        The name of the parameter.
+        ///
+        /// @return The value of the parameter.
+        ///
+        std::uint64_t Get(const std::string& name) const noexcept;
+
+        /// @return The named parameter values.
+        ///
+        const std::vector<Parameter>& GetParameters() const noexcept { return m_parameters; }
+
+        /// @return A description of the parameter values suitable for appending
+        /// to a benchmark name, in the form "/name:value/name:value".
+        ///
+        std::string ToString() const noexcept;
+
+    private:
+        std::vector<Parameter> m_parameters;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -38,4 +38,10 @@ namespace IC
     {
         m_benchmarks.push_back(benchmark);
     }
+
+    //------------------------------------------------------------------------------
+    void BenchmarkRegistry::RegisterSoakBenchmark(const Benchmark& benchmark) noexcept
+    {
+        m_soakBenchmarks.push_back(benchmark);
+    }
 }
\ No newline at end of file
@@ -55,6 +55,20 @@ namespace IC
         ///
         const std::vector<Benchmark>& GetBenchmarks() const noexcept { return m_benchmarks; }
 
+        /// Adds a new soak benchmark to the registry. Soak benchmarks run for a
+        /// fixed wall-clock duration rather than a calibrated number of
+        /// iterations, so they are kept apart from the other benchmarks and
+        /// only run in soak mode.
+        ///
+        /// @param benchmark
+        ///        The soak benchmark which should be added to the registry.
+        ///
+        void RegisterSoakBenchmark(const Benchmark& benchmark) noexcept;
+
+        /// @return The list of all currently registered soak benchmarks.
+        ///
+        const std::vector<Benchmark>& GetSoakBenchmarks() const noexcept { return m_soakBenchmarks; }
+
     private:
         BenchmarkRegistry() = default;
         BenchmarkRegistry(const BenchmarkRegistry&) = delete;
@@ -63,6 +77,7 @@ namespace IC
         BenchmarkRegistry& operator=(BenchmarkRegistry&&) = delete;
 
         std::vector<Benchmark> m_benchmarks;
+        std::vector<Benchmark> m_soakBenchmarks;
     };
 }
 
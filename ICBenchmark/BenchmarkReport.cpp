@@ -24,12 +24,122 @@
 
 #include "BenchmarkReport.h"
 
+#include <algorithm>
+#include <cassert>
+
 namespace IC
 {
     //------------------------------------------------------------------------------
-    BenchmarkReport::Benchmark::Benchmark(const std::string& name, std::uint32_t timeTaken) noexcept
-        : m_name(name), m_timeTaken(timeTaken)
+    BenchmarkReport::Benchmark::Benchmark(const std::string& name, const BenchmarkMeasurement& measurement, const BenchmarkParameters& parameters) noexcept
+        : m_name(name), m_parameters(parameters), m_measurement(measurement), m_statistics(measurement.m_samples)
+    {
+        assert(m_measurement.m_numIterations > 0);
+    }
+
+    //------------------------------------------------------------------------------
+    BenchmarkReport::Benchmark::Benchmark(const std::string& name, const std::string& error, const BenchmarkParameters& parameters) noexcept
+        : m_name(name), m_error(error), m_parameters(parameters)
+    {
+        assert(!m_error.empty());
+    }
+
+    //------------------------------------------------------------------------------
+    double BenchmarkReport::Benchmark::GetTimePerIteration() const noexcept
+    {
+        if (m_measurement.m_numIterations == 0)
+        {
+            return 0.0;
+        }
+
+        return m_statistics.GetMedian() / static_cast<double>(m_measurement.m_numIterations);
+    }
+
+    //------------------------------------------------------------------------------
+    double BenchmarkReport::Benchmark::GetTimePerOperation() const noexcept
     {
+        if (m_measurement.m_numOperations == 0)
+        {
+            return 0.0;
+        }
+
+        return m_statistics.GetMedian() / static_cast<double>(m_measurement.m_numOperations);
+    }
+
+    //------------------------------------------------------------------------------
+    double BenchmarkReport::Benchmark::GetOperationsPerSecond() const noexcept
+    {
+        if (m_measurement.m_numOperations == 0 || m_statistics.GetMedian() <= 0.0)
+        {
+            return 0.0;
+        }
+
+        return static_cast<double>(m_measurement.m_numOperations) * 1000000000.0 / m_statistics.GetMedian();
+    }
+
+    //------------------------------------------------------------------------------
+    double BenchmarkReport::Benchmark::GetAllocatedBytesPerSecond() const noexcept
+    {
+        if (m_measurement.m_numAllocatedBytes == 0 || m_statistics.GetMedian() <= 0.0)
+        {
+            return 0.0;
+        }
+
+        return static_cast<double>(m_measurement.m_numAllocatedBytes) * 1000000000.0 / m_statistics.GetMedian();
+    }
+
+    //------------------------------------------------------------------------------
+    double BenchmarkReport::Benchmark::GetThreadImbalance() const noexcept
+    {
+        const auto& threadTimes = m_measurement.m_threadTimes;
+        if (threadTimes.empty())
+        {
+            return 0.0;
+        }
+
+        double total = 0.0;
+        for (auto threadTime : threadTimes)
+        {
+            total += static_cast<double>(threadTime);
+        }
+
+        auto mean = total / static_cast<double>(threadTimes.size());
+        if (mean <= 0.0)
+        {
+            return 0.0;
+        }
+
+        return static_cast<double>(*std::max_element(threadTimes.begin(), threadTimes.end())) / mean - 1.0;
+    }
+
+    //------------------------------------------------------------------------------
+    double BenchmarkReport::Benchmark::GetPerformanceCounterPerOperation(PerformanceCounter counter) const noexcept
+    {
+        const auto& performanceCounters = m_measurement.m_performanceCounters;
+        if (m_measurement.m_numOperations == 0 || !performanceCounters.IsAvailable(counter))
+        {
+            return 0.0;
+        }
+
+        auto totalNumOperations = static_cast<double>(m_measurement.m_numOperations) * static_cast<double>(m_measurement.m_samples.size());
+        return static_cast<double>(performanceCounters.GetValue(counter)) / totalNumOperations;
+    }
+
+    //------------------------------------------------------------------------------
+    std::map<std::string, double> BenchmarkReport::Benchmark::GetCounters() const noexcept
+    {
+        std::map<std::string, double> counters;
+        if (m_measurement.m_samples.empty())
+        {
+            return counters;
+        }
+
+        auto numSamples = static_cast<double>(m_measurement.m_samples.size());
+        for (const auto& counter : m_measurement.m_counters)
+        {
+            counters[counter.first] = counter.second / numSamples;
+        }
+
+        return counters;
     }
 
     //------------------------------------------------------------------------------
@@ -39,8 +149,8 @@ namespace IC
     }
 
     //------------------------------------------------------------------------------
-    BenchmarkReport::BenchmarkReport(const std::vector<BenchmarkGroup>& benchmarkGroups) noexcept
-        : m_benchmarkGroups(benchmarkGroups)
+    BenchmarkReport::BenchmarkReport(const std::vector<BenchmarkGroup>& benchmarkGroups, const BenchmarkEnvironment& environment, const HarnessOverhead& overhead) noexcept
+        : m_benchmarkGroups(benchmarkGroups), m_environment(environment), m_overhead(overhead)
     {
     }
 }
\ No newline at end of file
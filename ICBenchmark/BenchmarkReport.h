@@ -25,8 +25,15 @@
 #ifndef _ICBENCHMARK_BENCHMARKREPORT_H_
 #define _ICBENCHMARK_BENCHMARKREPORT_H_
 
+#include "BenchmarkEnvironment.h"
+#include "HarnessOverhead.h"
+#include "BenchmarkMeasurement.h"
+#include "BenchmarkParameters.h"
 #include "ForwardDeclarations.h"
+#include "Statistics.h"
 
+#include <cstdint>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -48,26 +55,158 @@ namespace IC
         class Benchmark final
         {
         public:
-            /// Creates a new instance with the given name and time taken.
+            /// Creates a new instance for a benchmark which completed successfully.
             ///
             /// @param name
             ///        The name of the benchmark.
-            /// @param timeTimen
-            ///        The time in milliseconds that the benchmark took to complete.
+            /// @param measurement
+            ///        The data measured over all runs of the benchmark. Must
+            ///        contain at least one sample.
+            /// @param parameters
+            ///        (Optional) The parameter values of the benchmark.
             ///
-            Benchmark(const std::string& name, std::uint32_t timeTaken) noexcept;
+            Benchmark(const std::string& name, const BenchmarkMeasurement& measurement, const BenchmarkParameters& parameters = BenchmarkParameters()) noexcept;
+
+            /// Creates a new instance for a benchmark which failed to complete,
+            /// for example because it crashed or timed out.
+            ///
+            /// @param name
+            ///        The name of the benchmark.
+            /// @param error
+            ///        A description of the failure.
+            /// @param parameters
+            ///        (Optional) The parameter values of the benchmark.
+            ///
+            Benchmark(const std::string& name, const std::string& error, const BenchmarkParameters& parameters = BenchmarkParameters()) noexcept;
 
             /// @return The name of the benchmark.
             ///
             const std::string& GetName() const noexcept { return m_name; }
 
-            /// @return The time in milliseconds that the benchmark took to complete.
+            /// @return The parameter values of the benchmark, which are empty if
+            /// it isn't parameterised.
+            ///
+            const BenchmarkParameters& GetParameters() const noexcept { return m_parameters; }
+
+            /// @return Whether or not the benchmark failed to complete. A failed
+            /// benchmark has no samples.
+            ///
+            bool HasFailed() const noexcept { return !m_error.empty(); }
+
+            /// @return A description of why the benchmark failed, or an empty
+            /// string if it succeeded.
+            ///
+            const std::string& GetError() const noexcept { return m_error; }
+
+            /// @return The time in nanoseconds that each measured run of the
+            /// benchmark took to complete, in the order they were run.
+            ///
+            const std::vector<std::uint64_t>& GetSamples() const noexcept { return m_measurement.m_samples; }
+
+            /// @return Statistics describing the time samples, in nanoseconds. These
+            /// are all zero if the benchmark failed.
+            ///
+            const Statistics& GetStatistics() const noexcept { return m_statistics; }
+
+            /// @return The number of iterations performed by each run of the
+            /// benchmark.
+            ///
+            std::uint64_t GetNumIterations() const noexcept { return m_measurement.m_numIterations; }
+
+            /// @return The time in nanoseconds taken by a single iteration in the
+            /// median run.
+            ///
+            double GetTimePerIteration() const noexcept;
+
+            /// @return The number of operations performed by each run of the
+            /// benchmark, or zero if unknown.
+            ///
+            std::uint64_t GetNumOperations() const noexcept { return m_measurement.m_numOperations; }
+
+            /// @return The time in nanoseconds taken by a single operation in the
+            /// median run, or zero if the number of operations is unknown.
+            ///
+            double GetTimePerOperation() const noexcept;
+
+            /// @return The number of operations performed per second in the
+            /// median run, or zero if the number of operations is unknown.
+            ///
+            double GetOperationsPerSecond() const noexcept;
+
+            /// @return The number of bytes allocated by each run of the benchmark,
+            /// or zero if unknown.
+            ///
+            std::uint64_t GetNumAllocatedBytes() const noexcept { return m_measurement.m_numAllocatedBytes; }
+
+            /// @return The number of bytes allocated per second in the median run,
+            /// or zero if the number of bytes is unknown.
+            ///
+            double GetAllocatedBytesPerSecond() const noexcept;
+
+            /// @return The performance counter values accumulated over all measured
+            /// runs of the benchmark. All counters are unavailable if they were
+            /// not recorded.
+            ///
+            const PerformanceCounterValues& GetPerformanceCounters() const noexcept { return m_measurement.m_performanceCounters; }
+
+            /// @param counter
+            ///        The counter.
+            ///
+            /// @return The average value of the given counter for a single
+            /// operation, or zero if the counter or number of operations is
+            /// unavailable.
+            ///
+            double GetPerformanceCounterPerOperation(PerformanceCounter counter) const noexcept;
+
+            /// @return The latencies, in CycleClock ticks, of the individual
+            /// allocations made during all measured runs. This is empty if
+            /// latencies were not recorded.
+            ///
+            const LatencyHistogram& GetAllocationLatencies() const noexcept { return m_measurement.m_allocationLatencies; }
+
+            /// @return The latencies, in CycleClock ticks, of the individual
+            /// deallocations made during all measured runs. This is empty if
+            /// latencies were not recorded.
+            ///
+            const LatencyHistogram& GetDeallocationLatencies() const noexcept { return m_measurement.m_deallocationLatencies; }
+
+            /// @return The operating system resources used while the timer was
+            /// running, accumulated over all measured runs.
+            ///
+            const ResourceUsage& GetResourceUsage() const noexcept { return m_measurement.m_resourceUsage; }
+
+            /// @return The time in nanoseconds spent by each thread of a multi-
+            /// threaded benchmark, indexed by thread and summed over all measured
+            /// runs. This is empty for single threaded benchmarks.
+            ///
+            const std::vector<std::uint64_t>& GetThreadTimes() const noexcept { return m_measurement.m_threadTimes; }
+
+            /// @return The imbalance between the threads of a multi-threaded
+            /// benchmark: the time taken by the slowest thread relative to the
+            /// mean, minus one. Zero means every thread took the same time.
+            ///
+            double GetThreadImbalance() const noexcept;
+
+            /// @return The benchmark specific counters set by the benchmark, keyed
+            /// by name. Each value is the mean over all measured runs.
+            ///
+            std::map<std::string, double> GetCounters() const noexcept;
+
+            /// @return The snapshots recorded by a soak benchmark, in order. This
+            /// is empty for other benchmarks.
             ///
-            std::uint32_t GetTimeTaken() const noexcept { return m_timeTaken; }
+            const std::vector<SoakSnapshot>& GetSnapshots() const noexcept { return m_measurement.m_snapshots; }
+
+            /// @return The raw data measured over all runs of the benchmark.
+            ///
+            const BenchmarkMeasurement& GetMeasurement() const noexcept { return m_measurement; }
 
         private:
             std::string m_name;
-            std::uint32_t m_timeTaken;
+            std::string m_error;
+            BenchmarkParameters m_parameters;
+            BenchmarkMeasurement m_measurement;
+            Statistics m_statistics;
         };
 
         /// Contains report data pertaining to a benchmark group.
@@ -103,15 +242,31 @@ namespace IC
         ///
         /// @param benchmarkGroups
         ///        A list containing data on the benchmark groups.
+        /// @param environment
+        ///        A description of the environment the benchmarks were run in.
+        /// @param overhead
+        ///        The measured overhead of the harness.
         ///
-        BenchmarkReport(const std::vector<BenchmarkGroup>& benchmarkGroups) noexcept;
+        BenchmarkReport(const std::vector<BenchmarkGroup>& benchmarkGroups, const BenchmarkEnvironment& environment = BenchmarkEnvironment(),
+            const HarnessOverhead& overhead = HarnessOverhead()) noexcept;
 
         /// @return A list containing data on the benchmark groups.
         ///
         const std::vector<BenchmarkGroup>& GetBenchmarkGroups() const noexcept { return m_benchmarkGroups; }
 
+        /// @return A description of the environment the benchmarks were run in.
+        ///
+        const BenchmarkEnvironment& GetEnvironment() const noexcept { return m_environment; }
+
+        /// @return The measured overhead of the harness, which is unavailable if
+        /// it wasn't measured.
+        ///
+        const HarnessOverhead& GetHarnessOverhead() const noexcept { return m_overhead; }
+
     private:
         std::vector<BenchmarkGroup> m_benchmarkGroups;
+        BenchmarkEnvironment m_environment;
+        HarnessOverhead m_overhead;
     };
 }
 
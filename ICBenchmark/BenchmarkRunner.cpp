@@ -23,12 +23,22 @@
 // SOFTWARE.
 
 #include "BenchmarkRunner.h"
+#include "BenchmarkContext.h"
+#include "BenchmarkMeasurement.h"
 #include "BenchmarkRegistry.h"
-#include "Timer.h"
+#include "CacheEvictor.h"
+#include "CpuControl.h"
+#include "HarnessOverhead.h"
+#include "PerformanceCounters.h"
+#include "ProcessIsolation.h"
+#include "ResourceUsage.h"
 
 #include <algorithm>
 #include <cassert>
-#include <unordered_map>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
 
 namespace IC
 {
@@ -36,63 +46,674 @@ namespace IC
     {
         namespace
         {
-            /// Executes the given benchmark and returns a report detailing the time taken in milliseconds.
+            /// Executes a single run of the given benchmark.
             ///
             /// @param benchmark
             ///        The benchmark that should be run.
+            /// @param context
+            ///        The context that the benchmark should be run in.
+            ///
+            void RunBenchmarkOnce(const Benchmark& benchmark, BenchmarkContext& context)
+            {
+                benchmark.GetBenchmarkDelegate()(context);
+                assert(!context.IsTimerRunning());
+            }
+
+            /// @param context
+            ///        The context of a completed run.
+            ///
+            /// @return The time in nanoseconds the run counts towards the minimum
+            /// run time: the elapsed time plus any time spent evicting caches or
+            /// excluded by the benchmark.
+            ///
+            std::uint64_t GetRunTime(const BenchmarkContext& context) noexcept
+            {
+                return context.GetElapsedTime() + context.GetEvictionTime() + context.GetExcludedTime();
+            }
+
+            /// Finds the number of iterations the given benchmark should perform so
+            /// that a single run lasts at least the minimum run time. The number of
+            /// iterations starts at one and is grown geometrically, using the time
+            /// taken by the previous run to predict how many are needed. The
+            /// calibration runs are discarded.
+            ///
+            /// Early runs of a benchmark are often far slower than the rest, for
+            /// example because its memory is touched for the first time, and
+            /// predicting from them would stop the calibration early. The first
+            /// run of a single iteration is therefore discarded, and once a run
+            /// reaches the minimum run time it is repeated: if the repeat takes
+            /// less than half the minimum, the calibration continues from it.
+            ///
+            /// Benchmarks that don't request the number of iterations perform a
+            /// fixed amount of work, so are only run once. Time spent evicting the
+            /// caches is excluded from the measurement but still counts towards
+            /// the run time, otherwise cold benchmarks could run for far longer
+            /// than requested. The same applies to time the benchmark excluded
+            /// itself.
+            ///
+            /// @param benchmark
+            ///        The benchmark that should be calibrated.
+            /// @param options
+            ///        Describes how the benchmark should be run.
+            ///
+            /// @return The number of iterations to perform.
+            ///
+            std::uint64_t CalibrateNumIterations(const Benchmark& benchmark, const BenchmarkOptions& options)
+            {
+                constexpr double k_maxGrowth = 10.0;
+                constexpr double k_overshoot = 1.4;
+
+                std::uint64_t numIterations = 1;
+                bool warm = false;
+                bool confirming = false;
+
+                while (true)
+                {
+                    BenchmarkContext context(numIterations);
+                    context.SetWorkerCpus(&options.m_cpus);
+                    RunBenchmarkOnce(benchmark, context);
+
+                    if (!context.IsIterationBased() || numIterations >= options.m_maxIterations)
+                    {
+                        return numIterations;
+                    }
+
+                    if (!warm)
+                    {
+                        warm = true;
+                        continue;
+                    }
+
+                    auto elapsedTime = GetRunTime(context);
+                    if (confirming && elapsedTime >= options.m_minRunTime / 2)
+                    {
+                        return numIterations;
+                    }
+
+                    confirming = !confirming && elapsedTime >= options.m_minRunTime;
+                    if (confirming)
+                    {
+                        continue;
+                    }
+
+                    auto growth = k_maxGrowth;
+                    if (elapsedTime > 0)
+                    {
+                        growth = std::min(k_maxGrowth, k_overshoot * static_cast<double>(options.m_minRunTime) / static_cast<double>(elapsedTime));
+                    }
+
+                    auto nextNumIterations = static_cast<std::uint64_t>(static_cast<double>(numIterations) * growth);
+                    numIterations = std::min(options.m_maxIterations, std::max(numIterations + 1, nextNumIterations));
+                }
+            }
+
+            /// Creates a cold cache variant of the given benchmark, named after the
+            /// original with a "/cold" suffix. The caches are evicted before each
+            /// run and, for benchmarks which iterate on the calling thread, before
+            /// every interval of iterations, in both cases with the timer paused.
+            ///
+            /// @param benchmark
+            ///        The benchmark to create the variant of.
+            /// @param cacheEvictor
+            ///        The evictor used to flush the caches. This must outlive the
+            ///        returned benchmark.
+            /// @param evictionInterval
+            ///        The number of iterations between evictions.
+            ///
+            /// @return The cold variant of the benchmark.
+            ///
+            Benchmark CreateColdBenchmark(const Benchmark& benchmark, CacheEvictor* cacheEvictor, std::uint64_t evictionInterval) noexcept
+            {
+                auto delegate = benchmark.GetBenchmarkDelegate();
+                auto coldDelegate = [=](BenchmarkContext& context) noexcept
+                {
+                    cacheEvictor->Evict();
+                    context.SetCacheEvictor(cacheEvictor, evictionInterval);
+                    delegate(context);
+                };
+
+                return Benchmark(benchmark.GetBenchmarkGroupName(), benchmark.GetBenchmarkName() + "/cold", coldDelegate, benchmark.GetParameters());
+            }
+
+            /// Executes the given benchmark the requested number of warmup runs
+            /// followed by the requested number of measured runs.
+            ///
+            /// The state of the process can change between calibration and
+            /// measurement, for example the thresholds the C runtime's allocator
+            /// adapts as other benchmarks run, so the calibrated number of
+            /// iterations can be far too small. If recalibration is allowed and
+            /// the first measured run of an iteration based benchmark lasts less
+            /// than half the minimum run time, the benchmark is calibrated again
+            /// and the measurement restarted.
+            ///
+            /// @param benchmark
+            ///        The benchmark that should be run.
+            /// @param options
+            ///        Describes how the benchmark should be run.
+            /// @param numIterations
+            ///        The number of iterations each run should perform.
+            /// @param numRepetitions
+            ///        The number of measured runs.
+            /// @param recalibrate
+            ///        Whether or not the benchmark may be recalibrated. The number
+            ///        of iterations actually performed is returned in the
+            ///        measurement.
+            ///
+            /// @return The data measured over the measured runs.
+            ///
+            BenchmarkMeasurement MeasureBenchmark(const Benchmark& benchmark, const BenchmarkOptions& options, std::uint64_t numIterations, std::uint32_t numRepetitions,
+                bool recalibrate)
+            {
+                for (std::uint32_t i = 0; i < options.m_numWarmupRuns; ++i)
+                {
+                    BenchmarkContext context(numIterations);
+                    context.SetWorkerCpus(&options.m_cpus);
+                    RunBenchmarkOnce(benchmark, context);
+                }
+
+                std::unique_ptr<PerformanceCounters> performanceCounters;
+                if (options.m_recordPerformanceCounters)
+                {
+                    performanceCounters.reset(new PerformanceCounters());
+                }
+
+                BenchmarkMeasurement measurement;
+                measurement.m_numIterations = numIterations;
+
+                auto allocationLatencies = options.m_recordLatencies ? &measurement.m_allocationLatencies : nullptr;
+                auto deallocationLatencies = options.m_recordLatencies ? &measurement.m_deallocationLatencies : nullptr;
+
+                ResourceUsageTracker resourceUsage;
+
+                for (std::uint32_t i = 0; i < numRepetitions; ++i)
+                {
+                    BenchmarkContext context(numIterations, performanceCounters.get(), allocationLatencies, deallocationLatencies, &resourceUsage);
+                    context.SetWorkerCpus(&options.m_cpus);
+                    if (options.m_soakDuration > 0)
+                    {
+                        context.SetSoak(options.m_soakDuration, options.m_snapshotInterval);
+                    }
+                    RunBenchmarkOnce(benchmark, context);
+
+                    if (recalibrate && i == 0 && context.IsIterationBased() && numIterations < options.m_maxIterations && GetRunTime(context) < options.m_minRunTime / 2)
+                    {
+                        return MeasureBenchmark(benchmark, options, CalibrateNumIterations(benchmark, options), numRepetitions, false);
+                    }
+
+                    measurement.m_samples.push_back(context.GetElapsedTime());
+                    measurement.m_numOperations = context.GetNumOperations();
+                    measurement.m_numAllocatedBytes = context.GetNumAllocatedBytes();
+                    measurement.m_numTimerWindows = context.GetNumTimerWindows();
+
+                    const auto& threadTimes = context.GetThreadTimes();
+                    measurement.m_threadTimes.resize(std::max(measurement.m_threadTimes.size(), threadTimes.size()), 0);
+                    for (std::size_t j = 0; j < threadTimes.size(); ++j)
+                    {
+                        measurement.m_threadTimes[j] += threadTimes[j];
+                    }
+
+                    for (const auto& counter : context.GetCounters())
+                    {
+                        measurement.m_counters[counter.first] += counter.second;
+                    }
+
+                    const auto& snapshots = context.GetSnapshots();
+                    measurement.m_snapshots.insert(measurement.m_snapshots.end(), snapshots.begin(), snapshots.end());
+                }
+
+                if (performanceCounters)
+                {
+                    measurement.m_performanceCounters = performanceCounters->Read();
+                }
+
+                measurement.m_resourceUsage = resourceUsage.GetResourceUsage();
+
+                return measurement;
+            }
+
+            /// Performs the given measurement work in a forked child process.
+            ///
+            /// @param work
+            ///        The work, which returns the measurement to send back.
+            /// @param options
+            ///        Describes how the benchmark should be run.
+            /// @param out_measurement
+            ///        (Out) The measurement taken by the child, if successful.
+            /// @param out_error
+            ///        (Out) A description of the failure, if unsuccessful.
+            ///
+            /// @return Whether or not the child succeeded.
+            ///
+            bool MeasureInChildProcess(const std::function<BenchmarkMeasurement()>& work, const BenchmarkOptions& options, BenchmarkMeasurement& out_measurement, std::string& out_error)
+            {
+                std::string result;
+                if (!ProcessIsolation::Run([&work]() noexcept { return work().Serialise(); }, options.m_timeoutSeconds, result, out_error))
+                {
+                    return false;
+                }
+
+                if (!out_measurement.Deserialise(result))
+                {
+                    out_error = "Child process returned an invalid result";
+                    return false;
+                }
+
+                return true;
+            }
+
+            /// Calibrates the number of iterations the given benchmark should
+            /// perform, in a child process if each repetition is isolated.
+            ///
+            /// @param benchmark
+            ///        The benchmark that should be calibrated.
+            /// @param options
+            ///        Describes how the benchmark should be run.
+            /// @param isolation
+            ///        The isolation mode in effect.
+            /// @param out_numIterations
+            ///        (Out) The number of iterations to perform, if successful.
+            /// @param out_error
+            ///        (Out) A description of the failure, if unsuccessful.
+            ///
+            /// @return Whether or not calibration succeeded.
+            ///
+            bool Calibrate(const Benchmark& benchmark, const BenchmarkOptions& options, BenchmarkIsolation isolation, std::uint64_t& out_numIterations, std::string& out_error)
+            {
+                if (isolation == BenchmarkIsolation::k_none)
+                {
+                    out_numIterations = CalibrateNumIterations(benchmark, options);
+                    return true;
+                }
+
+                BenchmarkMeasurement calibration;
+                auto calibrate = [&benchmark, &options]()
+                {
+                    BenchmarkMeasurement result;
+                    result.m_numIterations = CalibrateNumIterations(benchmark, options);
+                    return result;
+                };
+
+                if (!MeasureInChildProcess(calibrate, options, calibration, out_error))
+                {
+                    return false;
+                }
+
+                out_numIterations = calibration.m_numIterations;
+                return true;
+            }
+
+            /// Performs a single measured run of the given benchmark, preceded by
+            /// the requested number of warmup runs, in a child process if each
+            /// repetition is isolated.
+            ///
+            /// @param benchmark
+            ///        The benchmark that should be run.
+            /// @param options
+            ///        Describes how the benchmark should be run.
+            /// @param isolation
+            ///        The isolation mode in effect.
+            /// @param numIterations
+            ///        The number of iterations the run should perform.
+            /// @param recalibrate
+            ///        Whether or not the benchmark may be recalibrated if the run
+            ///        is too short; see MeasureBenchmark().
+            /// @param out_measurement
+            ///        (Out) The measurement of the run, if successful.
+            /// @param out_error
+            ///        (Out) A description of the failure, if unsuccessful.
+            ///
+            /// @return Whether or not the run succeeded.
+            ///
+            bool MeasureRepetition(const Benchmark& benchmark, const BenchmarkOptions& options, BenchmarkIsolation isolation, std::uint64_t numIterations, bool recalibrate,
+                BenchmarkMeasurement& out_measurement, std::string& out_error)
+            {
+                if (isolation == BenchmarkIsolation::k_none)
+                {
+                    out_measurement = MeasureBenchmark(benchmark, options, numIterations, 1, recalibrate);
+                    return true;
+                }
+
+                auto measure = [&benchmark, &options, numIterations, recalibrate]()
+                {
+                    return MeasureBenchmark(benchmark, options, numIterations, 1, recalibrate);
+                };
+
+                return MeasureInChildProcess(measure, options, out_measurement, out_error);
+            }
+
+            /// Calibrates the number of iterations the given benchmark should
+            /// perform, then executes it the requested number of warmup and
+            /// measured times, and returns a report detailing the time taken by
+            /// each measured run in nanoseconds. Depending on the options this
+            /// is performed in this process or in one or more child processes.
+            ///
+            /// @param benchmark
+            ///        The benchmark that should be run.
+            /// @param options
+            ///        Describes how the benchmark should be run.
+            /// @param isolation
+            ///        The isolation mode in effect.
             ///
             /// @return A report on the result of the given benchmark.
             ///
-            BenchmarkReport::Benchmark RunBenchmark(const Benchmark& benchmark)
+            BenchmarkReport::Benchmark RunBenchmark(const Benchmark& benchmark, const BenchmarkOptions& options, BenchmarkIsolation isolation)
             {
-                Timer timer(false);
+                assert(options.m_numRepetitions > 0);
+
+                BenchmarkMeasurement measurement;
+                std::string error;
+
+                switch (isolation)
+                {
+                case BenchmarkIsolation::k_none:
+                {
+                    auto numIterations = CalibrateNumIterations(benchmark, options);
+                    measurement = MeasureBenchmark(benchmark, options, numIterations, options.m_numRepetitions, true);
+                    break;
+                }
+                case BenchmarkIsolation::k_perBenchmark:
+                {
+                    auto work = [&benchmark, &options]()
+                    {
+                        auto numIterations = CalibrateNumIterations(benchmark, options);
+                        return MeasureBenchmark(benchmark, options, numIterations, options.m_numRepetitions, true);
+                    };
+
+                    if (!MeasureInChildProcess(work, options, measurement, error))
+                    {
+                        return BenchmarkReport::Benchmark(benchmark.GetBenchmarkName(), error, benchmark.GetParameters());
+                    }
+                    break;
+                }
+                case BenchmarkIsolation::k_perRepetition:
+                {
+                    std::uint64_t numIterations = 0;
+                    if (!Calibrate(benchmark, options, isolation, numIterations, error))
+                    {
+                        return BenchmarkReport::Benchmark(benchmark.GetBenchmarkName(), error, benchmark.GetParameters());
+                    }
 
-                benchmark.GetBenchmarkDelegate()(timer);
-                assert(!timer.IsRunning());
+                    for (std::uint32_t i = 0; i < options.m_numRepetitions; ++i)
+                    {
+                        BenchmarkMeasurement repetition;
+                        if (!MeasureRepetition(benchmark, options, isolation, numIterations, i == 0, repetition, error))
+                        {
+                            return BenchmarkReport::Benchmark(benchmark.GetBenchmarkName(), error, benchmark.GetParameters());
+                        }
 
-                return BenchmarkReport::Benchmark(benchmark.GetBenchmarkName(), timer.GetElapsedTime());
+                        numIterations = repetition.m_numIterations;
+                        measurement.Merge(repetition);
+                    }
+                    break;
+                }
+                default:
+                    assert(false);
+                    break;
+                }
+
+                return BenchmarkReport::Benchmark(benchmark.GetBenchmarkName(), measurement, benchmark.GetParameters());
             }
 
-            /// Compiles the given results data into a benchmark report.
+            /// Runs the given soak benchmark once for the soak duration, with no
+            /// calibration or warmup, in a child process if isolation is
+            /// requested. The isolation timeout is extended by the duration.
             ///
-            /// @param results
-            ///        The results data map.
+            /// @param benchmark
+            ///        The soak benchmark that should be run.
+            /// @param options
+            ///        Describes how the benchmark should be run.
+            /// @param isolation
+            ///        The isolation mode in effect.
             ///
-            /// @return The compiled report.
+            /// @return A report on the result of the given benchmark.
             ///
-            BenchmarkReport GenerateReport(const std::unordered_map<std::string, std::vector<BenchmarkReport::Benchmark>>& results)
+            BenchmarkReport::Benchmark RunSoakBenchmark(const Benchmark& benchmark, const BenchmarkOptions& options, BenchmarkIsolation isolation)
             {
-                std::vector<BenchmarkReport::BenchmarkGroup> benchmarkGroupReports;
+                assert(options.m_soakDuration > 0);
 
-                for (const auto& result : results)
+                auto soakOptions = options;
+                soakOptions.m_numWarmupRuns = 0;
+                if (soakOptions.m_timeoutSeconds > 0)
                 {
-                    auto benchmarks = result.second;
+                    soakOptions.m_timeoutSeconds += static_cast<std::uint32_t>(options.m_soakDuration / 1000000000);
+                }
 
-                    std::sort(benchmarks.begin(), benchmarks.end(), [](const BenchmarkReport::Benchmark& a, const BenchmarkReport::Benchmark& b)
+                BenchmarkMeasurement measurement;
+                if (isolation == BenchmarkIsolation::k_none)
+                {
+                    measurement = MeasureBenchmark(benchmark, soakOptions, 1, 1, false);
+                }
+                else
+                {
+                    std::string error;
+                    auto work = [&benchmark, &soakOptions]()
                     {
-                        return a.GetTimeTaken() < b.GetTimeTaken();
-                    });
+                        return MeasureBenchmark(benchmark, soakOptions, 1, 1, false);
+                    };
 
-                    benchmarkGroupReports.push_back(BenchmarkReport::BenchmarkGroup(result.first, benchmarks));
+                    if (!MeasureInChildProcess(work, soakOptions, measurement, error))
+                    {
+                        return BenchmarkReport::Benchmark(benchmark.GetBenchmarkName(), error, benchmark.GetParameters());
+                    }
                 }
 
-                return benchmarkGroupReports;
+                return BenchmarkReport::Benchmark(benchmark.GetBenchmarkName(), measurement, benchmark.GetParameters());
+            }
+
+            /// Subtracts the overhead of the harness from each sample of the given
+            /// benchmark: the timer overhead for each timer window in a run, and
+            /// the iteration overhead for each iteration. Samples are clamped at
+            /// zero.
+            ///
+            /// @param benchmark
+            ///        The benchmark report.
+            /// @param overhead
+            ///        The measured overhead of the harness.
+            ///
+            /// @return The report with the overhead subtracted, or the given
+            /// report if the benchmark failed.
+            ///
+            BenchmarkReport::Benchmark SubtractOverhead(const BenchmarkReport::Benchmark& benchmark, const HarnessOverhead& overhead) noexcept
+            {
+                if (benchmark.HasFailed())
+                {
+                    return benchmark;
+                }
+
+                auto measurement = benchmark.GetMeasurement();
+                auto runOverhead = overhead.m_timerOverhead * static_cast<double>(measurement.m_numTimerWindows)
+                    + overhead.m_iterationOverhead * static_cast<double>(measurement.m_numIterations);
+                auto sampleOverhead = static_cast<std::uint64_t>(runOverhead + 0.5);
+
+                for (auto& sample : measurement.m_samples)
+                {
+                    sample -= std::min(sample, sampleOverhead);
+                }
+
+                return BenchmarkReport::Benchmark(benchmark.GetName(), measurement, benchmark.GetParameters());
+            }
+
+            /// Shuffles the given indices with a Fisher-Yates shuffle. The
+            /// standard library's shuffle algorithms are implementation defined,
+            /// so this is used to give the same order on every platform for a
+            /// given seed.
+            ///
+            /// @param indices
+            ///        (Out) The indices to shuffle.
+            /// @param random
+            ///        The random number generator.
+            ///
+            void Shuffle(std::vector<std::size_t>& indices, std::mt19937& random) noexcept
+            {
+                for (std::size_t i = indices.size(); i > 1; --i)
+                {
+                    std::swap(indices[i - 1], indices[random() % i]);
+                }
+            }
+
+            /// Runs the benchmarks in a group with their repetitions interleaved.
+            /// Every benchmark is calibrated first, then the repetitions are run
+            /// in rounds, each of which performs one measured run of every
+            /// benchmark in a shuffled order. Slow drift in the machine's
+            /// performance, for example from thermal throttling, is therefore
+            /// spread evenly across the benchmarks rather than penalising
+            /// whichever runs last. Each measured run is preceded by its own
+            /// warmup runs, since the previous run was of a different benchmark.
+            ///
+            /// A benchmark which fails is reported as such and skipped in later
+            /// rounds.
+            ///
+            /// @param benchmarks
+            ///        The benchmarks in the group.
+            /// @param options
+            ///        Describes how the benchmarks should be run.
+            /// @param isolation
+            ///        The isolation mode in effect. This must not be
+            ///        k_perBenchmark.
+            /// @param random
+            ///        The random number generator used to shuffle each round.
+            ///
+            /// @return Reports on the results of the benchmarks, in the same
+            /// order as the given benchmarks.
+            ///
+            std::vector<BenchmarkReport::Benchmark> RunInterleaved(const std::vector<const Benchmark*>& benchmarks, const BenchmarkOptions& options,
+                BenchmarkIsolation isolation, std::mt19937& random)
+            {
+                assert(isolation != BenchmarkIsolation::k_perBenchmark);
+                assert(options.m_numRepetitions > 0);
+
+                std::vector<std::uint64_t> numIterations(benchmarks.size(), 0);
+                std::vector<BenchmarkMeasurement> measurements(benchmarks.size());
+                std::vector<std::string> errors(benchmarks.size());
+
+                for (std::size_t i = 0; i < benchmarks.size(); ++i)
+                {
+                    Calibrate(*benchmarks[i], options, isolation, numIterations[i], errors[i]);
+                }
+
+                std::vector<std::size_t> order(benchmarks.size());
+                for (std::size_t i = 0; i < order.size(); ++i)
+                {
+                    order[i] = i;
+                }
+
+                for (std::uint32_t round = 0; round < options.m_numRepetitions; ++round)
+                {
+                    Shuffle(order, random);
+
+                    for (auto index : order)
+                    {
+                        if (!errors[index].empty())
+                        {
+                            continue;
+                        }
+
+                        BenchmarkMeasurement repetition;
+                        if (MeasureRepetition(*benchmarks[index], options, isolation, numIterations[index], round == 0, repetition, errors[index]))
+                        {
+                            numIterations[index] = repetition.m_numIterations;
+                            measurements[index].Merge(repetition);
+                        }
+                    }
+                }
+
+                std::vector<BenchmarkReport::Benchmark> reports;
+                for (std::size_t i = 0; i < benchmarks.size(); ++i)
+                {
+                    const auto& benchmark = *benchmarks[i];
+                    if (!errors[i].empty())
+                    {
+                        reports.push_back(BenchmarkReport::Benchmark(benchmark.GetBenchmarkName(), errors[i], benchmark.GetParameters()));
+                    }
+                    else
+                    {
+                        reports.push_back(BenchmarkReport::Benchmark(benchmark.GetBenchmarkName(), measurements[i], benchmark.GetParameters()));
+                    }
+                }
+
+                return reports;
             }
         }
 
         //------------------------------------------------------------------------------
-        BenchmarkReport Run() noexcept
+        BenchmarkReport Run(const BenchmarkOptions& options) noexcept
         {
-            auto benchmarks = BenchmarkRegistry::Get().GetBenchmarks();
+            if (!options.m_cpus.empty())
+            {
+                CpuControl::SetThreadAffinity(options.m_cpus.front());
+            }
 
-            std::unordered_map<std::string, std::vector<BenchmarkReport::Benchmark>> benchmarkResults;
+            if (options.m_realtimePriority)
+            {
+                CpuControl::SetRealtimePriority();
+            }
+
+            auto overhead = HarnessOverhead::Measure();
+            overhead.m_subtracted = options.m_subtractOverhead;
+
+            auto soak = options.m_soakDuration > 0;
+            const auto& registry = BenchmarkRegistry::Get();
+            const auto& registeredBenchmarks = soak ? registry.GetSoakBenchmarks() : registry.GetBenchmarks();
+
+            std::unique_ptr<CacheEvictor> cacheEvictor;
+            std::vector<Benchmark> coldBenchmarks;
+            if (options.m_cacheEviction != CacheEviction::k_none && !soak)
+            {
+                cacheEvictor.reset(new CacheEvictor(options.m_cacheEviction));
+                coldBenchmarks.reserve(registeredBenchmarks.size());
+            }
+
+            std::map<std::string, std::vector<const Benchmark*>> benchmarkGroups;
+            for (const auto& benchmark : registeredBenchmarks)
+            {
+                auto& benchmarkGroup = benchmarkGroups[benchmark.GetBenchmarkGroupName()];
+                benchmarkGroup.push_back(&benchmark);
+
+                if (cacheEvictor)
+                {
+                    coldBenchmarks.push_back(CreateColdBenchmark(benchmark, cacheEvictor.get(), options.m_evictionInterval));
+                    benchmarkGroup.push_back(&coldBenchmarks.back());
+                }
+            }
+
+            auto isolation = ProcessIsolation::IsSupported() ? options.m_isolation : BenchmarkIsolation::k_none;
+            std::mt19937 random(options.m_seed);
 
-            for (const auto& benchmark : benchmarks)
+            std::vector<BenchmarkReport::BenchmarkGroup> benchmarkGroupReports;
+            for (const auto& benchmarkGroup : benchmarkGroups)
             {
-                benchmarkResults[benchmark.GetBenchmarkGroupName()].push_back(RunBenchmark(benchmark));
+                std::vector<BenchmarkReport::Benchmark> benchmarkReports;
+                if (soak)
+                {
+                    for (auto benchmark : benchmarkGroup.second)
+                    {
+                        benchmarkReports.push_back(RunSoakBenchmark(*benchmark, options, isolation));
+                    }
+                }
+                else if (options.m_interleave && isolation != BenchmarkIsolation::k_perBenchmark)
+                {
+                    benchmarkReports = RunInterleaved(benchmarkGroup.second, options, isolation, random);
+                }
+                else
+                {
+                    for (auto benchmark : benchmarkGroup.second)
+                    {
+                        benchmarkReports.push_back(RunBenchmark(*benchmark, options, isolation));
+                    }
+                }
+
+                if (overhead.m_subtracted)
+                {
+                    for (auto& benchmarkReport : benchmarkReports)
+                    {
+                        benchmarkReport = SubtractOverhead(benchmarkReport, overhead);
+                    }
+                }
+
+                benchmarkGroupReports.push_back(BenchmarkReport::BenchmarkGroup(benchmarkGroup.first, benchmarkReports));
             }
 
-            return GenerateReport(benchmarkResults);
+            return BenchmarkReport(benchmarkGroupReports, BenchmarkEnvironment::Detect(), overhead);
         }
     }
 }
\ No newline at end of file
@@ -25,6 +25,7 @@
 #ifndef _ICBENCHMARK_BENCHMARKRUNNER_H_
 #define _ICBENCHMARK_BENCHMARKRUNNER_H_
 
+#include "BenchmarkOptions.h"
 #include "BenchmarkReport.h"
 
 namespace IC
@@ -36,11 +37,28 @@ namespace IC
     namespace BenchmarkRunner
     {
         /// Collects all benchmarks currently registered with the BenchmarkRegistry
-        /// and runs them one by one. Once complete a report is compiled and returned.
+        /// and runs them group by group. The number of iterations performed by
+        /// each benchmark is first calibrated to meet the requested minimum run
+        /// time. Each benchmark is then run the requested number of warmup
+        /// times, the results of which are discarded, and then the requested
+        /// number of measured repetitions, which may be interleaved with those
+        /// of the other benchmarks in the group. Once complete a report is
+        /// compiled and returned, with the groups ordered by name and the
+        /// benchmarks in each group in the order they were registered.
+        ///
+        /// If a soak duration is given, only the soak benchmarks are run instead,
+        /// each once for that duration with no calibration or warmup.
+        ///
+        /// If the options request CPU pinning or real-time priority these are
+        /// applied to the calling thread before any benchmark runs, and remain
+        /// in effect afterwards.
+        ///
+        /// @param options
+        ///        Describes how the benchmarks should be run.
         ///
         /// @return A report detailing the results of the benchmarks.
         ///
-        BenchmarkReport Run() noexcept;
+        BenchmarkReport Run(const BenchmarkOptions& options = BenchmarkOptions()) noexcept;
     }
 }
 
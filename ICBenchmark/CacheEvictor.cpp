@@ -0,0 +1,140 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "CacheEvictor.h"
+
+#include "OptimisationBarrier.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace IC
+{
+    namespace
+    {
+        constexpr std::size_t k_cacheLineSize = 64;
+        constexpr std::size_t k_pageSize = 4096;
+        constexpr std::size_t k_defaultCacheSize = 32 * 1024 * 1024;
+        constexpr std::size_t k_bufferToCacheRatio = 2;
+
+        /// Parses a cache size as exposed by sysfs, for example "32768K".
+        ///
+        /// @param size
+        ///        The size string.
+        ///
+        /// @return The size in bytes, or zero if it couldn't be parsed.
+        ///
+        std::size_t ParseCacheSize(const std::string& size) noexcept
+        {
+            std::size_t value = 0;
+            std::size_t i = 0;
+            for (; i < size.size() && size[i] >= '0' && size[i] <= '9'; ++i)
+            {
+                value = value * 10 + static_cast<std::size_t>(size[i] - '0');
+            }
+
+            if (i < size.size())
+            {
+                switch (size[i])
+                {
+                case 'K':
+                    return value * 1024;
+                case 'M':
+                    return value * 1024 * 1024;
+                case 'G':
+                    return value * 1024 * 1024 * 1024;
+                default:
+                    return 0;
+                }
+            }
+
+            return value;
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    CacheEvictor::CacheEvictor(CacheEviction eviction) noexcept
+    {
+        assert(eviction != CacheEviction::k_none);
+
+        m_bufferSize = GetLastLevelCacheSize() * k_bufferToCacheRatio;
+        if (eviction == CacheEviction::k_cachesAndTlb)
+        {
+            m_bufferSize = std::max(m_bufferSize, k_numTlbPages * k_pageSize);
+        }
+
+        m_buffer.reset(new std::uint8_t[m_bufferSize + k_pageSize]);
+
+#if defined(__linux__) && defined(MADV_NOHUGEPAGE)
+        if (eviction == CacheEviction::k_cachesAndTlb)
+        {
+            auto address = reinterpret_cast<std::uintptr_t>(m_buffer.get());
+            auto alignedAddress = (address + k_pageSize - 1) & ~static_cast<std::uintptr_t>(k_pageSize - 1);
+            madvise(reinterpret_cast<void*>(alignedAddress), m_bufferSize, MADV_NOHUGEPAGE);
+        }
+#endif
+
+        std::memset(m_buffer.get(), 1, m_bufferSize + k_pageSize);
+    }
+
+    //------------------------------------------------------------------------------
+    void CacheEvictor::Evict() noexcept
+    {
+        auto buffer = m_buffer.get();
+
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < m_bufferSize; i += k_cacheLineSize)
+        {
+            sum += buffer[i];
+        }
+
+        DoNotOptimise(sum);
+        ClobberMemory();
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t CacheEvictor::GetLastLevelCacheSize() noexcept
+    {
+        std::size_t largest = 0;
+
+        for (std::uint32_t index = 0;; ++index)
+        {
+            std::ifstream file("/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(index) + "/size");
+            std::string size;
+            if (!std::getline(file, size))
+            {
+                break;
+            }
+
+            largest = std::max(largest, ParseCacheSize(size));
+        }
+
+        return largest > 0 ? largest : k_defaultCacheSize;
+    }
+}
\ No newline at end of file
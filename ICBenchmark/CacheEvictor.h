@@ -0,0 +1,86 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_CACHEEVICTOR_H_
+#define _ICBENCHMARK_CACHEEVICTOR_H_
+
+#include "BenchmarkOptions.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace IC
+{
+    /// Evicts the contents of the CPU caches, and optionally the TLB, by
+    /// streaming through a buffer larger than the last level cache. This is
+    /// used to measure code as it performs when it hasn't run recently, rather
+    /// than with all of its data hot in L1.
+    ///
+    /// The buffer is allocated and touched on creation so that later
+    /// evictions don't page fault. Each eviction reads every cache line of the
+    /// buffer, which also touches every page, so most TLB entries are evicted
+    /// as a side effect. When TLB eviction is requested the buffer is made
+    /// large enough to cover k_numTlbPages pages, and transparent huge pages
+    /// are disabled for it where supported, so that this is guaranteed.
+    ///
+    /// Evicting takes milliseconds, so should always be done outside of the
+    /// timer.
+    ///
+    /// This is not thread-safe.
+    ///
+    class CacheEvictor final
+    {
+    public:
+        static constexpr std::size_t k_numTlbPages = 16384;
+
+        /// Creates a new evictor, sizing its buffer from the detected last
+        /// level cache size.
+        ///
+        /// @param eviction
+        ///        What should be evicted. Must not be k_none.
+        ///
+        CacheEvictor(CacheEviction eviction) noexcept;
+
+        /// Evicts the caches, and the TLB if requested.
+        ///
+        void Evict() noexcept;
+
+        /// @return The size of the buffer streamed by each eviction, in bytes.
+        ///
+        std::size_t GetBufferSize() const noexcept { return m_bufferSize; }
+
+        /// @return The size of the largest CPU cache in bytes, as read from the
+        /// operating system, or a conservative default if it can't be read.
+        ///
+        static std::size_t GetLastLevelCacheSize() noexcept;
+
+    private:
+        CacheEvictor(const CacheEvictor&) = delete;
+        CacheEvictor& operator=(const CacheEvictor&) = delete;
+
+        std::size_t m_bufferSize;
+        std::unique_ptr<std::uint8_t[]> m_buffer;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,174 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "CpuControl.h"
+
+#include <fstream>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace IC
+{
+    namespace CpuControl
+    {
+        namespace
+        {
+            /// Reads the first line of the given file, which is expected to be
+            /// a single value exposed by sysfs.
+            ///
+            /// @param path
+            ///        The path to the file.
+            /// @param out_value
+            ///        (Out) The first line of the file.
+            ///
+            /// @return Whether or not the file could be read.
+            ///
+            bool ReadSysfsValue(const std::string& path, std::string& out_value) noexcept
+            {
+                std::ifstream file(path);
+                return static_cast<bool>(std::getline(file, out_value));
+            }
+        }
+
+        //------------------------------------------------------------------------------
+        bool SetThreadAffinity(std::uint32_t cpu) noexcept
+        {
+#if defined(__linux__)
+            if (cpu >= CPU_SETSIZE)
+            {
+                return false;
+            }
+
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+            CPU_SET(cpu, &cpus);
+            return pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0;
+#else
+            (void)cpu;
+            return false;
+#endif
+        }
+
+        //------------------------------------------------------------------------------
+        std::vector<std::uint32_t> GetThreadAffinity() noexcept
+        {
+            std::vector<std::uint32_t> affinity;
+
+#if defined(__linux__)
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+            if (pthread_getaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0)
+            {
+                for (std::uint32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+                {
+                    if (CPU_ISSET(cpu, &cpus))
+                    {
+                        affinity.push_back(cpu);
+                    }
+                }
+            }
+#endif
+
+            return affinity;
+        }
+
+        //------------------------------------------------------------------------------
+        bool SetRealtimePriority() noexcept
+        {
+#if defined(__linux__)
+            sched_param parameters;
+            parameters.sched_priority = sched_get_priority_min(SCHED_FIFO);
+            return pthread_setschedparam(pthread_self(), SCHED_FIFO, &parameters) == 0;
+#else
+            return false;
+#endif
+        }
+
+        //------------------------------------------------------------------------------
+        std::string GetSchedulingPolicy() noexcept
+        {
+#if defined(__linux__)
+            int policy = 0;
+            sched_param parameters;
+            if (pthread_getschedparam(pthread_self(), &policy, &parameters) == 0)
+            {
+                switch (policy)
+                {
+                case SCHED_OTHER:
+                    return "SCHED_OTHER";
+                case SCHED_FIFO:
+                    return "SCHED_FIFO";
+                case SCHED_RR:
+                    return "SCHED_RR";
+#if defined(SCHED_BATCH)
+                case SCHED_BATCH:
+                    return "SCHED_BATCH";
+#endif
+#if defined(SCHED_IDLE)
+                case SCHED_IDLE:
+                    return "SCHED_IDLE";
+#endif
+                default:
+                    break;
+                }
+            }
+#endif
+
+            return "unknown";
+        }
+
+        //------------------------------------------------------------------------------
+        std::string GetFrequencyGovernor(std::uint32_t cpu) noexcept
+        {
+            std::string governor;
+            if (ReadSysfsValue("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cpufreq/scaling_governor", governor) && !governor.empty())
+            {
+                return governor;
+            }
+
+            return "unknown";
+        }
+
+        //------------------------------------------------------------------------------
+        std::string GetTurboBoostState() noexcept
+        {
+            std::string value;
+
+            // The Intel P-state driver exposes whether turbo is disabled, whereas
+            // the generic cpufreq interface exposes whether boost is enabled.
+            if (ReadSysfsValue("/sys/devices/system/cpu/intel_pstate/no_turbo", value))
+            {
+                return value == "1" ? "disabled" : "enabled";
+            }
+
+            if (ReadSysfsValue("/sys/devices/system/cpu/cpufreq/boost", value))
+            {
+                return value == "1" ? "enabled" : "disabled";
+            }
+
+            return "unknown";
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_CPUCONTROL_H_
+#define _ICBENCHMARK_CPUCONTROL_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace IC
+{
+    /// A collection of methods for controlling and inspecting the processor
+    /// state benchmarks run under: the CPUs a thread may run on, its scheduling
+    /// policy, and the frequency scaling configuration of the system. Pinning
+    /// threads and avoiding frequency changes greatly reduces the variance of
+    /// results on shared machines.
+    ///
+    /// These are only supported on Linux. On other platforms the setters fail
+    /// and the getters report that the state is unknown.
+    ///
+    namespace CpuControl
+    {
+        /// Restricts the calling thread to run on a single logical CPU.
+        ///
+        /// @param cpu
+        ///        The index of the logical CPU.
+        ///
+        /// @return Whether or not the affinity was set.
+        ///
+        bool SetThreadAffinity(std::uint32_t cpu) noexcept;
+
+        /// @return The logical CPUs the calling thread may run on, in ascending
+        /// order, or an empty list if this can't be determined.
+        ///
+        std::vector<std::uint32_t> GetThreadAffinity() noexcept;
+
+        /// Requests the SCHED_FIFO real-time scheduling policy, at its lowest
+        /// priority, for the calling thread. Threads it creates afterwards
+        /// inherit the policy. This usually requires elevated privileges.
+        ///
+        /// @return Whether or not the policy was set.
+        ///
+        bool SetRealtimePriority() noexcept;
+
+        /// @return The name of the scheduling policy of the calling thread, for
+        /// example "SCHED_OTHER" or "SCHED_FIFO", or "unknown".
+        ///
+        std::string GetSchedulingPolicy() noexcept;
+
+        /// @param cpu
+        ///        The index of the logical CPU.
+        ///
+        /// @return The name of the frequency scaling governor used by the given
+        /// CPU, for example "performance" or "powersave", or "unknown".
+        ///
+        std::string GetFrequencyGovernor(std::uint32_t cpu) noexcept;
+
+        /// @return "enabled" or "disabled" depending on whether turbo boost is
+        /// enabled, or "unknown" if the state can't be read.
+        ///
+        std::string GetTurboBoostState() noexcept;
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,68 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "CycleClock.h"
+
+namespace IC
+{
+    namespace CycleClock
+    {
+        namespace
+        {
+            /// Measures the duration of a tick by counting the ticks which elapse
+            /// during a fixed period of the steady clock.
+            ///
+            /// @return The number of nanoseconds per tick.
+            ///
+            double MeasureNanosecondsPerTick() noexcept
+            {
+                constexpr std::chrono::milliseconds k_calibrationTime(20);
+
+                auto startTime = std::chrono::steady_clock::now();
+                auto startTicks = Now();
+
+                auto endTime = startTime;
+                while (endTime - startTime < k_calibrationTime)
+                {
+                    endTime = std::chrono::steady_clock::now();
+                }
+
+                auto endTicks = Now();
+
+                auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+                if (endTicks <= startTicks)
+                {
+                    return 1.0;
+                }
+
+                return static_cast<double>(elapsedNs) / static_cast<double>(endTicks - startTicks);
+            }
+        }
+
+        //------------------------------------------------------------------------------
+        double GetNanosecondsPerTick() noexcept
+        {
+            static const double s_nanosecondsPerTick = MeasureNanosecondsPerTick();
+            return s_nanosecondsPerTick;
+        }
+    }
+}
\ No newline at end of file
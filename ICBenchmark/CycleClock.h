@@ -0,0 +1,87 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_CYCLECLOCK_H_
+#define _ICBENCHMARK_CYCLECLOCK_H_
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define IC_CYCLECLOCK_RDTSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define IC_CYCLECLOCK_RDTSC
+#endif
+
+namespace IC
+{
+    /// A very low overhead clock intended for timing individual operations,
+    /// where the cost of reading the steady clock would dominate. On x86 this
+    /// reads the time stamp counter, which on all modern processors ticks at a
+    /// constant rate regardless of frequency scaling. On other architectures
+    /// the platform's virtual counter or the steady clock is used instead.
+    ///
+    /// Ticks can be converted to nanoseconds using GetNanosecondsPerTick().
+    ///
+    /// This is thread-safe, although tick values are only comparable when read
+    /// on the same core.
+    ///
+    namespace CycleClock
+    {
+        /// @return The current value of the clock in ticks.
+        ///
+        inline std::uint64_t Now() noexcept
+        {
+#if defined(IC_CYCLECLOCK_RDTSC)
+            return __rdtsc();
+#elif defined(__aarch64__)
+            std::uint64_t value;
+            asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+            return value;
+#else
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+        }
+
+        /// Returns the duration of a single tick in nanoseconds. This is measured
+        /// against the steady clock the first time it is called, which takes a
+        /// few milliseconds.
+        ///
+        /// @return The number of nanoseconds per tick.
+        ///
+        double GetNanosecondsPerTick() noexcept;
+
+        /// @param ticks
+        ///        A duration in ticks.
+        ///
+        /// @return The given duration in nanoseconds.
+        ///
+        inline double ToNanoseconds(std::uint64_t ticks) noexcept
+        {
+            return static_cast<double>(ticks) * GetNanosecondsPerTick();
+        }
+    }
+}
+
+#endif
\ No newline at end of file
@@ -27,11 +27,34 @@
 
 namespace IC
 {
+    class AllocationTrace;
+    struct AllocationTraceHeader;
+    struct AllocationTraceRecord;
     class AutoRegisterBenchmark;
     class Benchmark;
+    class BenchmarkContext;
+    struct BenchmarkEnvironment;
+    class BenchmarkFixture;
+    struct BenchmarkMeasurement;
+    struct BenchmarkOptions;
+    class BenchmarkParameters;
+    class BenchmarkParameterSpace;
     class BenchmarkRegister;
     class BenchmarkReport;
+    class CacheEvictor;
+    class JsonValue;
+    class LatencyHistogram;
+    class PerformanceCounters;
+    class PerformanceCounterValues;
+    struct ResourceUsage;
+    class ResourceUsageTracker;
+    struct SoakSnapshot;
+    class Statistics;
     class Timer;
+    class WorkerPool;
+    struct Workload;
+    struct WorkloadComponent;
+    class WorkloadGenerator;
 }
 
 #endif
\ No newline at end of file
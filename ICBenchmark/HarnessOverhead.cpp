@@ -0,0 +1,109 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "HarnessOverhead.h"
+
+#include "Benchmark.h"
+#include "BenchmarkContext.h"
+#include "OptimisationBarrier.h"
+#include "Statistics.h"
+#include "Timer.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace IC
+{
+    namespace
+    {
+        constexpr std::uint32_t k_numSamples = 15;
+        constexpr std::uint64_t k_numTimerWindows = 10000;
+        constexpr std::uint64_t k_numIterations = 1000000;
+        constexpr std::uint64_t k_numDispatches = 100000;
+
+        /// An empty benchmark, whose iterations contain only a compiler
+        /// barrier so the loop itself can't be removed.
+        ///
+        /// @param context
+        ///        The context of the benchmark.
+        ///
+        void EmptyBenchmark(BenchmarkContext& context) noexcept
+        {
+            context.StartTimer();
+
+            for (auto iteration : context.GetIterations())
+            {
+                (void)iteration;
+                ClobberMemory();
+            }
+
+            context.StopTimer();
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    HarnessOverhead HarnessOverhead::Measure() noexcept
+    {
+        std::vector<std::uint64_t> timerSamples;
+        std::vector<std::uint64_t> iterationSamples;
+        std::vector<std::uint64_t> dispatchSamples;
+
+        Benchmark::BenchmarkDelegate emptyDelegate = [](BenchmarkContext&) noexcept {};
+
+        for (std::uint32_t i = 0; i < k_numSamples; ++i)
+        {
+            BenchmarkContext timerContext(1);
+            for (std::uint64_t j = 0; j < k_numTimerWindows; ++j)
+            {
+                timerContext.StartTimer();
+                timerContext.StopTimer();
+            }
+            timerSamples.push_back(timerContext.GetElapsedTime());
+
+            BenchmarkContext iterationContext(k_numIterations);
+            EmptyBenchmark(iterationContext);
+            iterationSamples.push_back(iterationContext.GetElapsedTime());
+
+            BenchmarkContext dispatchContext(1);
+            Timer dispatchTimer;
+            for (std::uint64_t j = 0; j < k_numDispatches; ++j)
+            {
+                emptyDelegate(dispatchContext);
+            }
+            dispatchTimer.Stop();
+            dispatchSamples.push_back(dispatchTimer.GetElapsedTime());
+        }
+
+        Statistics timerStatistics(timerSamples);
+        Statistics iterationStatistics(iterationSamples);
+        Statistics dispatchStatistics(dispatchSamples);
+
+        HarnessOverhead overhead;
+        overhead.m_available = true;
+        overhead.m_timerOverhead = timerStatistics.GetMedian() / static_cast<double>(k_numTimerWindows);
+        overhead.m_iterationOverhead = std::max(0.0, iterationStatistics.GetMedian() - overhead.m_timerOverhead) / static_cast<double>(k_numIterations);
+        overhead.m_dispatchOverhead = dispatchStatistics.GetMedian() / static_cast<double>(k_numDispatches);
+        overhead.m_noiseFloor = overhead.m_iterationOverhead + 2.0 * iterationStatistics.GetStandardDeviation() / static_cast<double>(k_numIterations);
+
+        return overhead;
+    }
+}
\ No newline at end of file
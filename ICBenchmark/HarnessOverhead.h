@@ -0,0 +1,78 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_HARNESSOVERHEAD_H_
+#define _ICBENCHMARK_HARNESSOVERHEAD_H_
+
+#include <cstdint>
+
+namespace IC
+{
+    /// The time the benchmark harness itself adds to measurements, found by
+    /// timing benchmarks which do nothing. Results which are close to these
+    /// values are dominated by the harness rather than the code being
+    /// measured.
+    ///
+    struct HarnessOverhead final
+    {
+        /// Measures the overhead of the harness in the running process. This
+        /// takes a fraction of a second.
+        ///
+        /// @return The measured overhead.
+        ///
+        static HarnessOverhead Measure() noexcept;
+
+        /// Whether or not the overhead was measured.
+        ///
+        bool m_available = false;
+
+        /// The time in nanoseconds added to a run each time the timer is
+        /// started or resumed and then stopped, mostly the cost of reading
+        /// the clock.
+        ///
+        double m_timerOverhead = 0.0;
+
+        /// The time in nanoseconds taken by a single iteration of an empty
+        /// IC_ITERATE() loop.
+        ///
+        double m_iterationOverhead = 0.0;
+
+        /// The time in nanoseconds taken to call a benchmark through its
+        /// delegate. This is outside of the timer, so is never part of a
+        /// measurement, but limits how quickly short runs can be repeated.
+        ///
+        double m_dispatchOverhead = 0.0;
+
+        /// The time per iteration in nanoseconds below which a result can't be
+        /// distinguished from an empty loop: the iteration overhead plus twice
+        /// its standard deviation across runs.
+        ///
+        double m_noiseFloor = 0.0;
+
+        /// Whether or not the timer and iteration overheads were subtracted
+        /// from every sample in the report.
+        ///
+        bool m_subtracted = false;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -25,11 +25,38 @@
 #ifndef _ICBENCHMARK_ICBENCHMARK_H_
 #define _ICBENCHMARK_ICBENCHMARK_H_
 
+#include "AllocationTrace.h"
+#include "AllocationTraceFormat.h"
 #include "AutoRegisterBenchmark.h"
 #include "Benchmark.h"
+#include "BenchmarkContext.h"
+#include "BenchmarkEnvironment.h"
+#include "BenchmarkFixture.h"
 #include "BenchmarkGroup.h"
+#include "BenchmarkMeasurement.h"
+#include "BenchmarkOptions.h"
+#include "BenchmarkParameters.h"
+#include "BenchmarkParameterSpace.h"
 #include "BenchmarkRegistry.h"
 #include "BenchmarkReport.h"
 #include "BenchmarkRunner.h"
+#include "CacheEvictor.h"
+#include "CpuControl.h"
+#include "CycleClock.h"
+#include "JsonValue.h"
+#include "LatencyHistogram.h"
+#include "LatencyProbe.h"
+#include "OptimisationBarrier.h"
+#include "PerformanceCounters.h"
+#include "ProcessIsolation.h"
+#include "ReportComparison.h"
+#include "ReportSerialiser.h"
+#include "ResourceUsage.h"
+#include "SoakSnapshot.h"
+#include "SpscQueue.h"
+#include "Statistics.h"
+#include "ThreadScaling.h"
+#include "WorkerPool.h"
+#include "WorkloadGenerator.h"
 
 #endif
\ No newline at end of file
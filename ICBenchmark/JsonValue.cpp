@@ -0,0 +1,445 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "JsonValue.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+namespace IC
+{
+    /// A recursive descent parser for JSON text. Nesting is limited so that
+    /// malformed input can't exhaust the stack.
+    ///
+    /// This is not thread-safe.
+    ///
+    class JsonValue::Parser final
+    {
+    public:
+        /// @param json
+        ///        The JSON text to parse.
+        ///
+        Parser(const std::string& json) noexcept
+            : m_json(json)
+        {
+        }
+
+        /// Parses the full text as a single value.
+        ///
+        /// @param out_value
+        ///        (Out) The parsed value.
+        ///
+        /// @return Whether or not the text was a single valid value.
+        ///
+        bool ParseDocument(JsonValue& out_value) noexcept
+        {
+            if (!ParseValue(out_value, 0))
+            {
+                return false;
+            }
+
+            SkipWhitespace();
+            return m_position == m_json.size();
+        }
+
+    private:
+        static constexpr std::size_t k_maxDepth = 64;
+
+        /// Advances past any whitespace.
+        ///
+        void SkipWhitespace() noexcept
+        {
+            while (m_position < m_json.size() && (m_json[m_position] == ' ' || m_json[m_position] == '\t' || m_json[m_position] == '\n' || m_json[m_position] == '\r'))
+            {
+                ++m_position;
+            }
+        }
+
+        /// Consumes the given literal if it is next in the text.
+        ///
+        /// @param literal
+        ///        The literal.
+        ///
+        /// @return Whether or not the literal was consumed.
+        ///
+        bool Consume(const char* literal) noexcept
+        {
+            std::size_t length = 0;
+            while (literal[length] != '\0')
+            {
+                if (m_position + length >= m_json.size() || m_json[m_position + length] != literal[length])
+                {
+                    return false;
+                }
+
+                ++length;
+            }
+
+            m_position += length;
+            return true;
+        }
+
+        /// Parses the value at the current position.
+        ///
+        /// @param out_value
+        ///        (Out) The parsed value.
+        /// @param depth
+        ///        The current nesting depth.
+        ///
+        /// @return Whether or not a valid value was parsed.
+        ///
+        bool ParseValue(JsonValue& out_value, std::size_t depth) noexcept
+        {
+            SkipWhitespace();
+            if (m_position >= m_json.size() || depth > k_maxDepth)
+            {
+                return false;
+            }
+
+            auto next = m_json[m_position];
+            if (next == '{')
+            {
+                return ParseObject(out_value, depth);
+            }
+            if (next == '[')
+            {
+                return ParseArray(out_value, depth);
+            }
+            if (next == '"')
+            {
+                out_value.m_type = Type::k_string;
+                return ParseString(out_value.m_string);
+            }
+            if (Consume("true"))
+            {
+                out_value.m_type = Type::k_bool;
+                out_value.m_bool = true;
+                return true;
+            }
+            if (Consume("false"))
+            {
+                out_value.m_type = Type::k_bool;
+                out_value.m_bool = false;
+                return true;
+            }
+            if (Consume("null"))
+            {
+                out_value.m_type = Type::k_null;
+                return true;
+            }
+
+            return ParseNumber(out_value);
+        }
+
+        /// Parses the number at the current position.
+        ///
+        /// @param out_value
+        ///        (Out) The parsed value.
+        ///
+        /// @return Whether or not a valid number was parsed.
+        ///
+        bool ParseNumber(JsonValue& out_value) noexcept
+        {
+            auto start = m_position;
+            while (m_position < m_json.size())
+            {
+                auto character = m_json[m_position];
+                if ((character < '0' || character > '9') && character != '-' && character != '+' && character != '.' && character != 'e' && character != 'E')
+                {
+                    break;
+                }
+
+                ++m_position;
+            }
+
+            if (start == m_position)
+            {
+                return false;
+            }
+
+            auto text = m_json.substr(start, m_position - start);
+            char* end = nullptr;
+            out_value.m_number = std::strtod(text.c_str(), &end);
+            out_value.m_type = Type::k_number;
+            return *end == '\0';
+        }
+
+        /// Parses the string at the current position. Escaped code points
+        /// are written as UTF-8.
+        ///
+        /// @param out_string
+        ///        (Out) The parsed string.
+        ///
+        /// @return Whether or not a valid string was parsed.
+        ///
+        bool ParseString(std::string& out_string) noexcept
+        {
+            if (!Consume("\""))
+            {
+                return false;
+            }
+
+            out_string.clear();
+            while (m_position < m_json.size())
+            {
+                auto character = m_json[m_position++];
+                if (character == '"')
+                {
+                    return true;
+                }
+
+                if (character != '\\')
+                {
+                    out_string += character;
+                    continue;
+                }
+
+                if (m_position >= m_json.size())
+                {
+                    return false;
+                }
+
+                auto escaped = m_json[m_position++];
+                switch (escaped)
+                {
+                case '"': out_string += '"'; break;
+                case '\\': out_string += '\\'; break;
+                case '/': out_string += '/'; break;
+                case 'b': out_string += '\b'; break;
+                case 'f': out_string += '\f'; break;
+                case 'n': out_string += '\n'; break;
+                case 'r': out_string += '\r'; break;
+                case 't': out_string += '\t'; break;
+                case 'u':
+                {
+                    if (m_position + 4 > m_json.size())
+                    {
+                        return false;
+                    }
+
+                    auto hex = m_json.substr(m_position, 4);
+                    char* end = nullptr;
+                    auto codePoint = std::strtoul(hex.c_str(), &end, 16);
+                    if (*end != '\0')
+                    {
+                        return false;
+                    }
+                    m_position += 4;
+
+                    if (codePoint < 0x80)
+                    {
+                        out_string += static_cast<char>(codePoint);
+                    }
+                    else if (codePoint < 0x800)
+                    {
+                        out_string += static_cast<char>(0xc0 | (codePoint >> 6));
+                        out_string += static_cast<char>(0x80 | (codePoint & 0x3f));
+                    }
+                    else
+                    {
+                        out_string += static_cast<char>(0xe0 | (codePoint >> 12));
+                        out_string += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+                        out_string += static_cast<char>(0x80 | (codePoint & 0x3f));
+                    }
+                    break;
+                }
+                default:
+                    return false;
+                }
+            }
+
+            return false;
+        }
+
+        /// Parses the array at the current position.
+        ///
+        /// @param out_value
+        ///        (Out) The parsed value.
+        /// @param depth
+        ///        The nesting depth of the array.
+        ///
+        /// @return Whether or not a valid array was parsed.
+        ///
+        bool ParseArray(JsonValue& out_value, std::size_t depth) noexcept
+        {
+            Consume("[");
+            out_value.m_type = Type::k_array;
+
+            SkipWhitespace();
+            if (Consume("]"))
+            {
+                return true;
+            }
+
+            while (true)
+            {
+                JsonValue element;
+                if (!ParseValue(element, depth + 1))
+                {
+                    return false;
+                }
+                out_value.m_elements.push_back(std::move(element));
+
+                SkipWhitespace();
+                if (Consume("]"))
+                {
+                    return true;
+                }
+                if (!Consume(","))
+                {
+                    return false;
+                }
+            }
+        }
+
+        /// Parses the object at the current position.
+        ///
+        /// @param out_value
+        ///        (Out) The parsed value.
+        /// @param depth
+        ///        The nesting depth of the object.
+        ///
+        /// @return Whether or not a valid object was parsed.
+        ///
+        bool ParseObject(JsonValue& out_value, std::size_t depth) noexcept
+        {
+            Consume("{");
+            out_value.m_type = Type::k_object;
+
+            SkipWhitespace();
+            if (Consume("}"))
+            {
+                return true;
+            }
+
+            while (true)
+            {
+                std::string name;
+                SkipWhitespace();
+                if (!ParseString(name))
+                {
+                    return false;
+                }
+
+                SkipWhitespace();
+                if (!Consume(":"))
+                {
+                    return false;
+                }
+
+                JsonValue member;
+                if (!ParseValue(member, depth + 1))
+                {
+                    return false;
+                }
+                out_value.m_members.emplace_back(std::move(name), std::move(member));
+
+                SkipWhitespace();
+                if (Consume("}"))
+                {
+                    return true;
+                }
+                if (!Consume(","))
+                {
+                    return false;
+                }
+            }
+        }
+
+        const std::string& m_json;
+        std::size_t m_position = 0;
+    };
+
+    //------------------------------------------------------------------------------
+    bool JsonValue::Parse(const std::string& json, JsonValue& out_value) noexcept
+    {
+        JsonValue value;
+        Parser parser(json);
+        if (!parser.ParseDocument(value))
+        {
+            return false;
+        }
+
+        out_value = std::move(value);
+        return true;
+    }
+
+    //------------------------------------------------------------------------------
+    std::string JsonValue::Quote(const std::string& value) noexcept
+    {
+        std::string quoted = "\"";
+        for (auto character : value)
+        {
+            switch (character)
+            {
+            case '"': quoted += "\\\""; break;
+            case '\\': quoted += "\\\\"; break;
+            case '\b': quoted += "\\b"; break;
+            case '\f': quoted += "\\f"; break;
+            case '\n': quoted += "\\n"; break;
+            case '\r': quoted += "\\r"; break;
+            case '\t': quoted += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(character) < 0x20)
+                {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(character));
+                    quoted += escaped;
+                }
+                else
+                {
+                    quoted += character;
+                }
+                break;
+            }
+        }
+
+        quoted += "\"";
+        return quoted;
+    }
+
+    //------------------------------------------------------------------------------
+    std::uint64_t JsonValue::GetUnsigned() const noexcept
+    {
+        if (m_type != Type::k_number || m_number < 0.0)
+        {
+            return 0;
+        }
+
+        return static_cast<std::uint64_t>(std::llround(m_number));
+    }
+
+    //------------------------------------------------------------------------------
+    const JsonValue* JsonValue::GetMember(const std::string& name) const noexcept
+    {
+        for (const auto& member : m_members)
+        {
+            if (member.first == name)
+            {
+                return &member.second;
+            }
+        }
+
+        return nullptr;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_JSONVALUE_H_
+#define _ICBENCHMARK_JSONVALUE_H_
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace IC
+{
+    /// A minimal, immutable JSON document model used to read back reports
+    /// which were previously written by the ReportSerialiser. Objects preserve
+    /// the order of their members.
+    ///
+    /// This is immutable and therefore thread-safe.
+    ///
+    class JsonValue final
+    {
+    public:
+        /// The type of a JSON value.
+        ///
+        enum class Type
+        {
+            k_null,
+            k_bool,
+            k_number,
+            k_string,
+            k_array,
+            k_object
+        };
+
+        /// Parses the given JSON text.
+        ///
+        /// @param json
+        ///        The JSON text.
+        /// @param out_value
+        ///        (Out) The parsed value. Only modified if parsing succeeds.
+        ///
+        /// @return Whether or not the text was valid JSON.
+        ///
+        static bool Parse(const std::string& json, JsonValue& out_value) noexcept;
+
+        /// @param value
+        ///        The string to quote.
+        ///
+        /// @return The given string as a quoted JSON string literal, with any
+        /// special characters escaped.
+        ///
+        static std::string Quote(const std::string& value) noexcept;
+
+        /// Creates a new null value.
+        ///
+        JsonValue() = default;
+
+        /// @return The type of the value.
+        ///
+        Type GetType() const noexcept { return m_type; }
+
+        /// @return The value as a bool, or false if it isn't one.
+        ///
+        bool GetBool() const noexcept { return m_bool; }
+
+        /// @return The value as a number, or zero if it isn't one.
+        ///
+        double GetNumber() const noexcept { return m_number; }
+
+        /// @return The value as an unsigned integer, or zero if it isn't a
+        /// non-negative number.
+        ///
+        std::uint64_t GetUnsigned() const noexcept;
+
+        /// @return The value as a string, or an empty string if it isn't one.
+        ///
+        const std::string& GetString() const noexcept { return m_string; }
+
+        /// @return The elements of the value, or an empty list if it isn't an
+        /// array.
+        ///
+        const std::vector<JsonValue>& GetElements() const noexcept { return m_elements; }
+
+        /// @param name
+        ///        The name of the member.
+        ///
+        /// @return The member of this object with the given name, or null if
+        /// this isn't an object or has no such member.
+        ///
+        const JsonValue* GetMember(const std::string& name) const noexcept;
+
+        /// @return The members of the value, in document order, or an empty
+        /// list if it isn't an object.
+        ///
+        const std::vector<std::pair<std::string, JsonValue>>& GetMembers() const noexcept { return m_members; }
+
+    private:
+        class Parser;
+
+        Type m_type = Type::k_null;
+        bool m_bool = false;
+        double m_number = 0.0;
+        std::string m_string;
+        std::vector<JsonValue> m_elements;
+        std::vector<std::pair<std::string, JsonValue>> m_members;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,117 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "LatencyHistogram.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace IC
+{
+    namespace
+    {
+        constexpr std::size_t k_numBuckets = (64 - 5 + 1) * 32;
+    }
+
+    //------------------------------------------------------------------------------
+    LatencyHistogram::LatencyHistogram() noexcept
+        : m_buckets(k_numBuckets, 0)
+    {
+        static_assert(k_numBuckets == (64 - k_subBucketBits + 1) * k_subBucketCount, "Bucket count doesn't match the sub-bucket layout.");
+    }
+
+    //------------------------------------------------------------------------------
+    void LatencyHistogram::Merge(const LatencyHistogram& other) noexcept
+    {
+        for (std::size_t i = 0; i < m_buckets.size(); ++i)
+        {
+            m_buckets[i] += other.m_buckets[i];
+        }
+
+        m_count += other.m_count;
+        m_max = std::max(m_max, other.m_max);
+    }
+
+    //------------------------------------------------------------------------------
+    std::uint64_t LatencyHistogram::GetPercentile(double percentile) const noexcept
+    {
+        assert(percentile > 0.0 && percentile <= 100.0);
+
+        if (m_count == 0)
+        {
+            return 0;
+        }
+
+        auto target = static_cast<std::uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(m_count)));
+        target = std::max<std::uint64_t>(target, 1);
+
+        std::uint64_t cumulative = 0;
+        for (std::size_t i = 0; i < m_buckets.size(); ++i)
+        {
+            cumulative += m_buckets[i];
+            if (cumulative >= target)
+            {
+                return std::min(GetBucketMidpoint(i), m_max);
+            }
+        }
+
+        return m_max;
+    }
+
+    //------------------------------------------------------------------------------
+    bool LatencyHistogram::SetBuckets(const std::vector<std::uint64_t>& buckets, std::uint64_t max) noexcept
+    {
+        if (buckets.size() != k_numBuckets)
+        {
+            return false;
+        }
+
+        m_buckets = buckets;
+        m_max = max;
+        m_count = 0;
+
+        for (auto count : m_buckets)
+        {
+            m_count += count;
+        }
+
+        return true;
+    }
+
+    //------------------------------------------------------------------------------
+    std::uint64_t LatencyHistogram::GetBucketMidpoint(std::size_t index) noexcept
+    {
+        if (index < k_subBucketCount)
+        {
+            return index;
+        }
+
+        auto shift = static_cast<std::uint32_t>(index / k_subBucketCount) - 1;
+        auto subBucket = (index % k_subBucketCount) + k_subBucketCount;
+
+        auto lowerBound = static_cast<std::uint64_t>(subBucket) << shift;
+        auto width = std::uint64_t(1) << shift;
+
+        return lowerBound + width / 2;
+    }
+}
\ No newline at end of file
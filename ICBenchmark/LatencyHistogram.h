@@ -0,0 +1,145 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_LATENCYHISTOGRAM_H_
+#define _ICBENCHMARK_LATENCYHISTOGRAM_H_
+
+#include <cstdint>
+#include <vector>
+
+namespace IC
+{
+    /// A histogram of latency values with logarithmically sized buckets, in the
+    /// style of an HDR histogram. Each power of two range is divided into a
+    /// fixed number of linear sub-buckets, so every recorded value is accurate
+    /// to within ~3% regardless of magnitude, while the histogram has a small
+    /// fixed size. Recording is a handful of integer operations so it can be
+    /// used for individual allocations.
+    ///
+    /// Values are unitless; typically they are CycleClock ticks.
+    ///
+    /// This is not thread-safe.
+    ///
+    class LatencyHistogram final
+    {
+    public:
+        /// Creates a new empty histogram.
+        ///
+        LatencyHistogram() noexcept;
+
+        /// Records a single value.
+        ///
+        /// @param value
+        ///        The value to record.
+        ///
+        void Record(std::uint64_t value) noexcept
+        {
+            ++m_buckets[GetBucketIndex(value)];
+            ++m_count;
+
+            if (value > m_max)
+            {
+                m_max = value;
+            }
+        }
+
+        /// Adds all values recorded in the given histogram to this one.
+        ///
+        /// @param other
+        ///        The histogram to merge.
+        ///
+        void Merge(const LatencyHistogram& other) noexcept;
+
+        /// @return The number of values recorded.
+        ///
+        std::uint64_t GetCount() const noexcept { return m_count; }
+
+        /// @return The largest value recorded, or zero if empty.
+        ///
+        std::uint64_t GetMax() const noexcept { return m_max; }
+
+        /// Calculates the value below which the given percentage of recorded
+        /// values fall. The result is the midpoint of the containing bucket.
+        ///
+        /// @param percentile
+        ///        The percentile in the range (0, 100].
+        ///
+        /// @return The value at the given percentile, or zero if empty.
+        ///
+        std::uint64_t GetPercentile(double percentile) const noexcept;
+
+        /// @return The count for each bucket. This is intended for serialisation.
+        ///
+        const std::vector<std::uint64_t>& GetBuckets() const noexcept { return m_buckets; }
+
+        /// Restores a histogram previously described by GetBuckets() and
+        /// GetMax().
+        ///
+        /// @param buckets
+        ///        The count for each bucket.
+        /// @param max
+        ///        The largest value recorded.
+        ///
+        /// @return Whether or not the buckets were valid for a histogram.
+        ///
+        bool SetBuckets(const std::vector<std::uint64_t>& buckets, std::uint64_t max) noexcept;
+
+    private:
+        static constexpr std::uint32_t k_subBucketBits = 5;
+        static constexpr std::uint64_t k_subBucketCount = 1 << k_subBucketBits;
+
+        /// @param value
+        ///        The value.
+        ///
+        /// @return The index of the bucket containing the given value.
+        ///
+        static std::size_t GetBucketIndex(std::uint64_t value) noexcept
+        {
+            if (value < k_subBucketCount)
+            {
+                return static_cast<std::size_t>(value);
+            }
+
+            std::uint32_t highestBit = 63;
+            while ((value >> highestBit) == 0)
+            {
+                --highestBit;
+            }
+
+            auto shift = highestBit - k_subBucketBits;
+            return static_cast<std::size_t>((shift + 1) * k_subBucketCount + ((value >> shift) - k_subBucketCount));
+        }
+
+        /// @param index
+        ///        The bucket index.
+        ///
+        /// @return The midpoint of the range of values in the given bucket.
+        ///
+        static std::uint64_t GetBucketMidpoint(std::size_t index) noexcept;
+
+        std::vector<std::uint64_t> m_buckets;
+        std::uint64_t m_count = 0;
+        std::uint64_t m_max = 0;
+    };
+}
+
+#endif
\ No newline at end of file
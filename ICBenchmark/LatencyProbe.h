@@ -0,0 +1,75 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_LATENCYPROBE_H_
+#define _ICBENCHMARK_LATENCYPROBE_H_
+
+#include "CycleClock.h"
+#include "LatencyHistogram.h"
+
+namespace IC
+{
+    /// Records the time between its construction and destruction into a
+    /// latency histogram, using the CycleClock. If no histogram is provided
+    /// the probe does nothing, so it can be left in benchmark code at minimal
+    /// cost when latencies aren't being recorded.
+    ///
+    /// This is typically used via the IC_TIMEALLOCATION() and
+    /// IC_TIMEDEALLOCATION() macros declared in BenchmarkGroup.h, which create
+    /// a temporary probe that lives for the duration of a single expression.
+    ///
+    /// This is not thread-safe.
+    ///
+    class LatencyProbe final
+    {
+    public:
+        /// Creates a new probe, starting the measurement.
+        ///
+        /// @param histogram
+        ///        (Optional) The histogram which the latency should be recorded
+        ///        in.
+        ///
+        LatencyProbe(LatencyHistogram* histogram) noexcept
+            : m_histogram(histogram), m_start(histogram ? CycleClock::Now() : 0)
+        {
+        }
+
+        /// Ends the measurement and records it in the histogram.
+        ///
+        ~LatencyProbe() noexcept
+        {
+            if (m_histogram)
+            {
+                m_histogram->Record(CycleClock::Now() - m_start);
+            }
+        }
+
+    private:
+        LatencyProbe(const LatencyProbe&) = delete;
+        LatencyProbe& operator=(const LatencyProbe&) = delete;
+
+        LatencyHistogram* m_histogram;
+        std::uint64_t m_start;
+    };
+}
+
+#endif
\ No newline at end of file
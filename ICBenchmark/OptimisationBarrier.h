@@ -0,0 +1,120 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_OPTIMISATIONBARRIER_H_
+#define _ICBENCHMARK_OPTIMISATIONBARRIER_H_
+
+#include <cstddef>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace IC
+{
+    namespace OptimisationBarrierInternal
+    {
+        /// Does nothing with the given pointer. This is defined in a separate
+        /// translation unit, so the compiler must assume that the pointed to
+        /// memory is read. It is only used where inline assembly isn't
+        /// available.
+        ///
+        /// @param pointer
+        ///        The pointer to escape.
+        ///
+        void UseCharPointer(const volatile char* pointer) noexcept;
+    }
+
+    /// Prevents the compiler from optimising away the given value, or the
+    /// computation which produced it. If the value is a pointer, the memory it
+    /// points to is also treated as escaped, so allocations whose result is
+    /// passed to this can't be elided.
+    ///
+    /// @param value
+    ///        The value which must be computed.
+    ///
+    template <typename TValue> inline void DoNotOptimise(const TValue& value) noexcept
+    {
+#if defined(_MSC_VER)
+        OptimisationBarrierInternal::UseCharPointer(&reinterpret_cast<const volatile char&>(value));
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : "r,m"(value) : "memory");
+#endif
+    }
+
+    /// Prevents the compiler from optimising away the given value, or the
+    /// computation which produced it, and forces it to assume that the value
+    /// may have been modified.
+    ///
+    /// @param value
+    ///        The value which must be computed.
+    ///
+    template <typename TValue> inline void DoNotOptimise(TValue& value) noexcept
+    {
+#if defined(_MSC_VER)
+        OptimisationBarrierInternal::UseCharPointer(&reinterpret_cast<const volatile char&>(value));
+        _ReadWriteBarrier();
+#elif defined(__clang__)
+        asm volatile("" : "+r,m"(value) : : "memory");
+#else
+        asm volatile("" : "+m,r"(value) : : "memory");
+#endif
+    }
+
+    /// Forces the compiler to assume that all memory may have been read and
+    /// written, so pending writes must be performed and values re-read.
+    ///
+    inline void ClobberMemory() noexcept
+    {
+#if defined(_MSC_VER)
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : : "memory");
+#endif
+    }
+
+    /// Writes to the first and last byte of the given memory and escapes it, so
+    /// that an allocation is used as it would be in practice. Only the ends
+    /// are written, rather than every byte, so that the cost of filling large
+    /// allocations doesn't swamp the cost of making them.
+    ///
+    /// @param memory
+    ///        The memory to touch. If this is null nothing is written.
+    /// @param size
+    ///        The size of the memory in bytes.
+    ///
+    inline void TouchMemory(void* memory, std::size_t size) noexcept
+    {
+        if (memory && size > 0)
+        {
+            auto bytes = static_cast<char*>(memory);
+            bytes[0] = 1;
+            bytes[size - 1] = 1;
+        }
+
+        DoNotOptimise(memory);
+        ClobberMemory();
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,317 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "PerformanceCounters.h"
+
+#include <cassert>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#endif
+
+namespace IC
+{
+    namespace
+    {
+#if defined(__linux__)
+        /// Describes the perf event used for each performance counter, and
+        /// whether it should be opened in the same group as the previous
+        /// counter so that both are always scheduled together.
+        ///
+        struct CounterDescription final
+        {
+            std::uint32_t m_type;
+            std::uint64_t m_config;
+            bool m_sharesPreviousGroup;
+        };
+
+        /// Builds the config for a generalised hardware cache event.
+        ///
+        constexpr std::uint64_t MakeCacheConfig(std::uint64_t cache, std::uint64_t operation, std::uint64_t result) noexcept
+        {
+            return cache | (operation << 8) | (result << 16);
+        }
+
+        const CounterDescription k_counterDescriptions[PerformanceCounterValues::k_numCounters] =
+        {
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, false },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, true },
+            { PERF_TYPE_HW_CACHE, MakeCacheConfig(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS), false },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, false },
+            { PERF_TYPE_HW_CACHE, MakeCacheConfig(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS), false },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, false },
+        };
+
+        /// Opens a single performance counter for the calling thread. Kernel
+        /// events are included where permitted, otherwise only user space
+        /// events are counted.
+        ///
+        /// @param description
+        ///        Describes the counter to open.
+        /// @param groupLeader
+        ///        The file descriptor of the group leader, or -1 if this counter
+        ///        should lead a new group.
+        ///
+        /// @return The file descriptor of the counter, or -1 if it couldn't be
+        /// opened.
+        ///
+        int OpenCounter(const CounterDescription& description, int groupLeader) noexcept
+        {
+            perf_event_attr attributes;
+            std::memset(&attributes, 0, sizeof(attributes));
+            attributes.size = sizeof(attributes);
+            attributes.type = description.m_type;
+            attributes.config = description.m_config;
+            attributes.disabled = (groupLeader == -1) ? 1 : 0;
+            attributes.inherit = 1;
+            attributes.exclude_hv = 1;
+            attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            auto fileDescriptor = static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, groupLeader, 0));
+            if (fileDescriptor == -1)
+            {
+                attributes.exclude_kernel = 1;
+                fileDescriptor = static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, groupLeader, 0));
+            }
+
+            return fileDescriptor;
+        }
+#endif
+    }
+
+    //------------------------------------------------------------------------------
+    std::string PerformanceCounterValues::GetName(PerformanceCounter counter) noexcept
+    {
+        switch (counter)
+        {
+        case PerformanceCounter::k_cycles:
+            return "cycles";
+        case PerformanceCounter::k_instructions:
+            return "instructions";
+        case PerformanceCounter::k_l1DataCacheMisses:
+            return "L1D misses";
+        case PerformanceCounter::k_lastLevelCacheMisses:
+            return "LLC misses";
+        case PerformanceCounter::k_dataTlbMisses:
+            return "dTLB misses";
+        case PerformanceCounter::k_branchMisses:
+            return "branch misses";
+        default:
+            assert(false);
+            return "";
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    PerformanceCounterValues::PerformanceCounterValues() noexcept
+    {
+        m_values.fill(0);
+        m_available.fill(false);
+        m_timesEnabled.fill(0);
+        m_timesRunning.fill(0);
+    }
+
+    //------------------------------------------------------------------------------
+    PerformanceCounterValues::PerformanceCounterValues(const std::array<std::uint64_t, k_numCounters>& values, const std::array<bool, k_numCounters>& available,
+        const std::array<std::uint64_t, k_numCounters>& timesEnabled, const std::array<std::uint64_t, k_numCounters>& timesRunning) noexcept
+        : m_values(values), m_available(available), m_timesEnabled(timesEnabled), m_timesRunning(timesRunning)
+    {
+    }
+
+    //------------------------------------------------------------------------------
+    bool PerformanceCounterValues::IsAnyAvailable() const noexcept
+    {
+        for (auto available : m_available)
+        {
+            if (available)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //------------------------------------------------------------------------------
+    bool PerformanceCounterValues::IsAnyMultiplexed() const noexcept
+    {
+        for (std::size_t i = 0; i < k_numCounters; ++i)
+        {
+            if (m_timesRunning[i] < m_timesEnabled[i])
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //------------------------------------------------------------------------------
+    double PerformanceCounterValues::GetInstructionsPerCycle() const noexcept
+    {
+        if (!IsAvailable(PerformanceCounter::k_cycles) || !IsAvailable(PerformanceCounter::k_instructions) || GetValue(PerformanceCounter::k_cycles) == 0)
+        {
+            return 0.0;
+        }
+
+        return static_cast<double>(GetValue(PerformanceCounter::k_instructions)) / static_cast<double>(GetValue(PerformanceCounter::k_cycles));
+    }
+
+    //------------------------------------------------------------------------------
+    bool PerformanceCounters::IsSupported() noexcept
+    {
+        PerformanceCounters counters;
+        for (auto fileDescriptor : counters.m_fileDescriptors)
+        {
+            if (fileDescriptor != -1)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //------------------------------------------------------------------------------
+    PerformanceCounters::PerformanceCounters() noexcept
+    {
+        m_fileDescriptors.fill(-1);
+        m_isGroupLeader.fill(false);
+
+#if defined(__linux__)
+        auto groupLeader = -1;
+        for (std::size_t i = 0; i < m_fileDescriptors.size(); ++i)
+        {
+            const auto& description = k_counterDescriptions[i];
+            if (description.m_sharesPreviousGroup && groupLeader != -1)
+            {
+                m_fileDescriptors[i] = OpenCounter(description, groupLeader);
+            }
+
+            if (m_fileDescriptors[i] == -1)
+            {
+                m_fileDescriptors[i] = OpenCounter(description, -1);
+                m_isGroupLeader[i] = (m_fileDescriptors[i] != -1);
+                groupLeader = m_fileDescriptors[i];
+            }
+        }
+#endif
+    }
+
+    //------------------------------------------------------------------------------
+    void PerformanceCounters::Start() noexcept
+    {
+#if defined(__linux__)
+        for (std::size_t i = 0; i < m_fileDescriptors.size(); ++i)
+        {
+            if (m_isGroupLeader[i])
+            {
+                ioctl(m_fileDescriptors[i], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+            }
+        }
+#endif
+    }
+
+    //------------------------------------------------------------------------------
+    void PerformanceCounters::Stop() noexcept
+    {
+#if defined(__linux__)
+        for (std::size_t i = 0; i < m_fileDescriptors.size(); ++i)
+        {
+            if (m_isGroupLeader[i])
+            {
+                ioctl(m_fileDescriptors[i], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+            }
+        }
+#endif
+    }
+
+    //------------------------------------------------------------------------------
+    PerformanceCounterValues PerformanceCounters::Read() const noexcept
+    {
+        std::array<std::uint64_t, PerformanceCounterValues::k_numCounters> values;
+        std::array<bool, PerformanceCounterValues::k_numCounters> available;
+        std::array<std::uint64_t, PerformanceCounterValues::k_numCounters> timesEnabled;
+        std::array<std::uint64_t, PerformanceCounterValues::k_numCounters> timesRunning;
+        values.fill(0);
+        available.fill(false);
+        timesEnabled.fill(0);
+        timesRunning.fill(0);
+
+#if defined(__linux__)
+        for (std::size_t i = 0; i < m_fileDescriptors.size(); ++i)
+        {
+            if (m_fileDescriptors[i] == -1)
+            {
+                continue;
+            }
+
+            std::uint64_t data[3] = { 0, 0, 0 };
+            if (read(m_fileDescriptors[i], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)))
+            {
+                continue;
+            }
+
+            auto value = data[0];
+            auto timeEnabled = data[1];
+            auto timeRunning = data[2];
+            timesEnabled[i] = timeEnabled;
+            timesRunning[i] = timeRunning;
+
+            if (timeRunning == 0)
+            {
+                available[i] = (timeEnabled == 0);
+                continue;
+            }
+
+            if (timeRunning < timeEnabled)
+            {
+                value = static_cast<std::uint64_t>(static_cast<double>(value) * static_cast<double>(timeEnabled) / static_cast<double>(timeRunning));
+            }
+
+            values[i] = value;
+            available[i] = true;
+        }
+#endif
+
+        return PerformanceCounterValues(values, available, timesEnabled, timesRunning);
+    }
+
+    //------------------------------------------------------------------------------
+    PerformanceCounters::~PerformanceCounters() noexcept
+    {
+#if defined(__linux__)
+        for (auto fileDescriptor : m_fileDescriptors)
+        {
+            if (fileDescriptor != -1)
+            {
+                close(fileDescriptor);
+            }
+        }
+#endif
+    }
+}
\ No newline at end of file
@@ -0,0 +1,194 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_PERFORMANCECOUNTERS_H_
+#define _ICBENCHMARK_PERFORMANCECOUNTERS_H_
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace IC
+{
+    /// The hardware performance counters which can be recorded for a benchmark.
+    ///
+    enum class PerformanceCounter
+    {
+        k_cycles,
+        k_instructions,
+        k_l1DataCacheMisses,
+        k_lastLevelCacheMisses,
+        k_dataTlbMisses,
+        k_branchMisses,
+        k_total
+    };
+
+    /// A set of values read from the hardware performance counters. Counters
+    /// which could not be opened or scheduled on this system are marked as
+    /// unavailable. The time each counter was enabled and actually running is
+    /// also kept, so that multiplexing by the kernel is visible: a counter
+    /// which was enabled but never running could not be scheduled.
+    ///
+    /// This is immutable and therefore thread-safe.
+    ///
+    class PerformanceCounterValues final
+    {
+    public:
+        static constexpr std::size_t k_numCounters = static_cast<std::size_t>(PerformanceCounter::k_total);
+
+        /// @param counter
+        ///        The counter.
+        ///
+        /// @return A human readable name for the given counter.
+        ///
+        static std::string GetName(PerformanceCounter counter) noexcept;
+
+        /// Creates a new instance in which all counters are unavailable.
+        ///
+        PerformanceCounterValues() noexcept;
+
+        /// Creates a new instance with the given values.
+        ///
+        /// @param values
+        ///        The value of each counter.
+        /// @param available
+        ///        Whether or not each counter is available.
+        /// @param timesEnabled
+        ///        The time in nanoseconds for which each counter was enabled.
+        /// @param timesRunning
+        ///        The time in nanoseconds for which each counter was actually
+        ///        counting on the PMU.
+        ///
+        PerformanceCounterValues(const std::array<std::uint64_t, k_numCounters>& values, const std::array<bool, k_numCounters>& available,
+            const std::array<std::uint64_t, k_numCounters>& timesEnabled, const std::array<std::uint64_t, k_numCounters>& timesRunning) noexcept;
+
+        /// @return Whether or not any counters are available.
+        ///
+        bool IsAnyAvailable() const noexcept;
+
+        /// @param counter
+        ///        The counter.
+        ///
+        /// @return Whether or not the given counter is available.
+        ///
+        bool IsAvailable(PerformanceCounter counter) const noexcept { return m_available[static_cast<std::size_t>(counter)]; }
+
+        /// @param counter
+        ///        The counter.
+        ///
+        /// @return The value of the given counter, or zero if it is unavailable.
+        ///
+        std::uint64_t GetValue(PerformanceCounter counter) const noexcept { return m_values[static_cast<std::size_t>(counter)]; }
+
+        /// @param counter
+        ///        The counter.
+        ///
+        /// @return The time in nanoseconds for which the given counter was
+        /// enabled, or zero if it couldn't be opened.
+        ///
+        std::uint64_t GetTimeEnabled(PerformanceCounter counter) const noexcept { return m_timesEnabled[static_cast<std::size_t>(counter)]; }
+
+        /// @param counter
+        ///        The counter.
+        ///
+        /// @return The time in nanoseconds for which the given counter was
+        /// actually counting. This is less than the time enabled if the kernel
+        /// multiplexed it with other counters.
+        ///
+        std::uint64_t GetTimeRunning(PerformanceCounter counter) const noexcept { return m_timesRunning[static_cast<std::size_t>(counter)]; }
+
+        /// @return Whether or not any counter was enabled for longer than it was
+        /// running, either because it was multiplexed or never scheduled.
+        ///
+        bool IsAnyMultiplexed() const noexcept;
+
+        /// @return The number of instructions retired per cycle, or zero if either
+        /// counter is unavailable.
+        ///
+        double GetInstructionsPerCycle() const noexcept;
+
+    private:
+        std::array<std::uint64_t, k_numCounters> m_values;
+        std::array<bool, k_numCounters> m_available;
+        std::array<std::uint64_t, k_numCounters> m_timesEnabled;
+        std::array<std::uint64_t, k_numCounters> m_timesRunning;
+    };
+
+    /// Provides access to the hardware performance counters for the calling
+    /// thread and any threads it creates while counting. Counting only occurs
+    /// between calls to Start() and Stop(), and accumulates over multiple such
+    /// windows.
+    ///
+    /// This is currently only supported on Linux, via perf_event_open. On other
+    /// platforms, or when access to the counters is denied (as is common in
+    /// containers), all counters are reported as unavailable.
+    ///
+    /// The kernel schedules each perf event group onto the PMU all or nothing,
+    /// so the counters are opened in small groups: cycles and instructions
+    /// together, so that their ratio is exact, and every other counter on its
+    /// own. This means a PMU with few free counters, as is common in virtual
+    /// machines or when the NMI watchdog holds one, still reports the counters
+    /// it can fit, multiplexing the rest.
+    ///
+    /// This is not thread-safe.
+    ///
+    class PerformanceCounters final
+    {
+    public:
+        /// @return Whether or not any performance counters can be opened on this
+        /// system.
+        ///
+        static bool IsSupported() noexcept;
+
+        /// Opens all of the performance counters supported by the system. They
+        /// are initially stopped.
+        ///
+        PerformanceCounters() noexcept;
+
+        /// Starts counting.
+        ///
+        void Start() noexcept;
+
+        /// Stops counting.
+        ///
+        void Stop() noexcept;
+
+        /// @return The values accumulated since the counters were opened. Where
+        /// the kernel had to multiplex the counters the values are scaled to
+        /// estimate the full count.
+        ///
+        PerformanceCounterValues Read() const noexcept;
+
+        ~PerformanceCounters() noexcept;
+
+    private:
+        PerformanceCounters(const PerformanceCounters&) = delete;
+        PerformanceCounters& operator=(const PerformanceCounters&) = delete;
+        PerformanceCounters(PerformanceCounters&&) = delete;
+        PerformanceCounters& operator=(PerformanceCounters&&) = delete;
+
+        std::array<int, PerformanceCounterValues::k_numCounters> m_fileDescriptors;
+        std::array<bool, PerformanceCounterValues::k_numCounters> m_isGroupLeader;
+    };
+}
+
+#endif
\ No newline at end of file
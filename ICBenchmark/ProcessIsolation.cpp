@@ -0,0 +1,243 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "ProcessIsolation.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define IC_PROCESSISOLATION_SUPPORTED
+
+#include <poll.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#endif
+
+namespace IC
+{
+    namespace ProcessIsolation
+    {
+#if defined(IC_PROCESSISOLATION_SUPPORTED)
+        namespace
+        {
+            /// Writes the whole of the given string to the file descriptor,
+            /// retrying on partial writes.
+            ///
+            /// @param fileDescriptor
+            ///        The file descriptor.
+            /// @param data
+            ///        The data to write.
+            ///
+            /// @return Whether or not all data was written.
+            ///
+            bool WriteAll(int fileDescriptor, const std::string& data) noexcept
+            {
+                std::size_t written = 0;
+                while (written < data.size())
+                {
+                    auto result = write(fileDescriptor, data.data() + written, data.size() - written);
+                    if (result < 0)
+                    {
+                        if (errno == EINTR)
+                        {
+                            continue;
+                        }
+
+                        return false;
+                    }
+
+                    written += static_cast<std::size_t>(result);
+                }
+
+                return true;
+            }
+
+            /// Reads from the file descriptor until the other end is closed or
+            /// the deadline passes.
+            ///
+            /// @param fileDescriptor
+            ///        The file descriptor.
+            /// @param deadline
+            ///        The time by which reading must have completed.
+            /// @param hasDeadline
+            ///        Whether or not the deadline applies.
+            /// @param out_data
+            ///        (Out) The data read.
+            ///
+            /// @return Whether or not the other end was closed before the
+            /// deadline.
+            ///
+            bool ReadAll(int fileDescriptor, std::chrono::steady_clock::time_point deadline, bool hasDeadline, std::string& out_data) noexcept
+            {
+                char buffer[4096];
+
+                while (true)
+                {
+                    int timeoutMs = -1;
+                    if (hasDeadline)
+                    {
+                        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+                        if (remaining <= 0)
+                        {
+                            return false;
+                        }
+
+                        timeoutMs = static_cast<int>(remaining);
+                    }
+
+                    pollfd pollDescriptor;
+                    pollDescriptor.fd = fileDescriptor;
+                    pollDescriptor.events = POLLIN;
+                    pollDescriptor.revents = 0;
+
+                    auto pollResult = poll(&pollDescriptor, 1, timeoutMs);
+                    if (pollResult < 0 && errno == EINTR)
+                    {
+                        continue;
+                    }
+
+                    if (pollResult == 0)
+                    {
+                        return false;
+                    }
+
+                    auto result = read(fileDescriptor, buffer, sizeof(buffer));
+                    if (result < 0 && errno == EINTR)
+                    {
+                        continue;
+                    }
+
+                    if (result <= 0)
+                    {
+                        return true;
+                    }
+
+                    out_data.append(buffer, static_cast<std::size_t>(result));
+                }
+            }
+        }
+#endif
+
+        //------------------------------------------------------------------------------
+        bool IsSupported() noexcept
+        {
+#if defined(IC_PROCESSISOLATION_SUPPORTED)
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        //------------------------------------------------------------------------------
+        bool Run(const Work& work, std::uint32_t timeoutSeconds, std::string& out_result, std::string& out_error) noexcept
+        {
+#if defined(IC_PROCESSISOLATION_SUPPORTED)
+            int pipeDescriptors[2];
+            if (pipe(pipeDescriptors) != 0)
+            {
+                out_error = std::string("Failed to create pipe: ") + std::strerror(errno);
+                return false;
+            }
+
+            // Anything left in the stdio buffers would otherwise be written twice.
+            std::cout.flush();
+            std::fflush(nullptr);
+
+            auto processId = fork();
+            if (processId < 0)
+            {
+                close(pipeDescriptors[0]);
+                close(pipeDescriptors[1]);
+                out_error = std::string("Failed to fork: ") + std::strerror(errno);
+                return false;
+            }
+
+            if (processId == 0)
+            {
+                close(pipeDescriptors[0]);
+
+                auto result = work();
+                auto success = WriteAll(pipeDescriptors[1], result);
+
+                close(pipeDescriptors[1]);
+                _exit(success ? 0 : 1);
+            }
+
+            close(pipeDescriptors[1]);
+
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(timeoutSeconds);
+            std::string result;
+            auto completed = ReadAll(pipeDescriptors[0], deadline, timeoutSeconds > 0, result);
+            close(pipeDescriptors[0]);
+
+            if (!completed)
+            {
+                kill(processId, SIGKILL);
+            }
+
+            int status = 0;
+            while (waitpid(processId, &status, 0) < 0 && errno == EINTR)
+            {
+            }
+
+            if (!completed)
+            {
+                out_error = "Timed out after " + std::to_string(timeoutSeconds) + "s";
+                return false;
+            }
+
+            if (WIFSIGNALED(status))
+            {
+                out_error = "Crashed with signal " + std::to_string(WTERMSIG(status));
+                const char* signalName = strsignal(WTERMSIG(status));
+                if (signalName)
+                {
+                    out_error += std::string(" (") + signalName + ")";
+                }
+
+                return false;
+            }
+
+            if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+            {
+                out_error = "Exited with status " + std::to_string(WIFEXITED(status) ? WEXITSTATUS(status) : -1);
+                return false;
+            }
+
+            out_result = result;
+            return true;
+#else
+            (void)work;
+            (void)timeoutSeconds;
+            (void)out_result;
+            out_error = "Process isolation is not supported on this platform";
+            return false;
+#endif
+        }
+    }
+}
\ No newline at end of file
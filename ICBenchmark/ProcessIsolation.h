@@ -0,0 +1,73 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_PROCESSISOLATION_H_
+#define _ICBENCHMARK_PROCESSISOLATION_H_
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace IC
+{
+    /// A container for functions for performing work in a separate, freshly
+    /// forked child process. This ensures that the work starts from the heap
+    /// state of the parent at the time of the fork, rather than one modified
+    /// by earlier work, and that a crash or hang is contained.
+    ///
+    /// This is currently supported on POSIX platforms only.
+    ///
+    /// This is not thread-safe, and must only be used while the calling
+    /// process has a single thread.
+    ///
+    namespace ProcessIsolation
+    {
+        /// The work to be performed in the child process. The returned string is
+        /// sent back to the parent.
+        ///
+        using Work = std::function<std::string() noexcept>;
+
+        /// @return Whether or not process isolation is supported on this
+        /// platform.
+        ///
+        bool IsSupported() noexcept;
+
+        /// Performs the given work in a forked child process and waits for it to
+        /// complete. If the child crashes, exits without returning a result, or
+        /// exceeds the timeout it is killed and an error is returned.
+        ///
+        /// @param work
+        ///        The work to perform in the child process.
+        /// @param timeoutSeconds
+        ///        The maximum time the child may take, or zero for no limit.
+        /// @param out_result
+        ///        (Out) The string returned by the work, if successful.
+        /// @param out_error
+        ///        (Out) A description of the failure, if unsuccessful.
+        ///
+        /// @return Whether or not the work completed successfully.
+        ///
+        bool Run(const Work& work, std::uint32_t timeoutSeconds, std::string& out_result, std::string& out_error) noexcept;
+    }
+}
+
+#endif
\ No newline at end of file
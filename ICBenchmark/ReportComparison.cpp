@@ -0,0 +1,185 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "ReportComparison.h"
+
+#include "BenchmarkReport.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace IC
+{
+    namespace ReportComparison
+    {
+        namespace
+        {
+            /// @param benchmark
+            ///        A successful benchmark.
+            ///
+            /// @return The time per iteration of each sample of the benchmark.
+            ///
+            std::vector<double> GetTimesPerIteration(const BenchmarkReport::Benchmark& benchmark) noexcept
+            {
+                std::vector<double> times;
+                for (auto sample : benchmark.GetSamples())
+                {
+                    times.push_back(static_cast<double>(sample) / static_cast<double>(benchmark.GetNumIterations()));
+                }
+
+                return times;
+            }
+
+            /// Performs a two-sided Mann-Whitney U test, using the normal
+            /// approximation with a correction for ties. This makes no assumption
+            /// about the distribution of the samples, which is important as
+            /// benchmark timings are typically skewed by outliers.
+            ///
+            /// @param a
+            ///        The first set of samples.
+            /// @param b
+            ///        The second set of samples.
+            ///
+            /// @return The p-value, or one if either set has too few samples for
+            /// the test to be meaningful.
+            ///
+            double MannWhitneyUTest(const std::vector<double>& a, const std::vector<double>& b) noexcept
+            {
+                constexpr std::size_t k_minSamples = 3;
+
+                if (a.size() < k_minSamples || b.size() < k_minSamples)
+                {
+                    return 1.0;
+                }
+
+                std::vector<std::pair<double, bool>> combined;
+                for (auto value : a)
+                {
+                    combined.emplace_back(value, true);
+                }
+                for (auto value : b)
+                {
+                    combined.emplace_back(value, false);
+                }
+                std::sort(combined.begin(), combined.end());
+
+                double rankSumA = 0.0;
+                double tieCorrection = 0.0;
+                for (std::size_t i = 0; i < combined.size();)
+                {
+                    auto j = i;
+                    while (j < combined.size() && combined[j].first == combined[i].first)
+                    {
+                        ++j;
+                    }
+
+                    auto averageRank = (static_cast<double>(i + 1) + static_cast<double>(j)) / 2.0;
+                    for (auto k = i; k < j; ++k)
+                    {
+                        rankSumA += combined[k].second ? averageRank : 0.0;
+                    }
+
+                    auto numTied = static_cast<double>(j - i);
+                    tieCorrection += numTied * numTied * numTied - numTied;
+                    i = j;
+                }
+
+                auto n1 = static_cast<double>(a.size());
+                auto n2 = static_cast<double>(b.size());
+                auto n = n1 + n2;
+                auto u = rankSumA - n1 * (n1 + 1.0) / 2.0;
+                auto mean = n1 * n2 / 2.0;
+                auto variance = n1 * n2 / 12.0 * ((n + 1.0) - tieCorrection / (n * (n - 1.0)));
+                if (variance <= 0.0)
+                {
+                    return 1.0;
+                }
+
+                auto z = (std::abs(u - mean) - 0.5) / std::sqrt(variance);
+                return std::min(1.0, std::erfc(std::max(0.0, z) / std::sqrt(2.0)));
+            }
+
+            /// @param report
+            ///        The report to search.
+            /// @param groupName
+            ///        The name of the group.
+            /// @param name
+            ///        The name of the benchmark.
+            ///
+            /// @return The successful benchmark with the given group and name, or
+            /// null if there isn't one.
+            ///
+            const BenchmarkReport::Benchmark* FindBenchmark(const BenchmarkReport& report, const std::string& groupName, const std::string& name) noexcept
+            {
+                for (const auto& benchmarkGroup : report.GetBenchmarkGroups())
+                {
+                    if (benchmarkGroup.GetName() != groupName)
+                    {
+                        continue;
+                    }
+
+                    for (const auto& benchmark : benchmarkGroup.GetBenchmarks())
+                    {
+                        if (benchmark.GetName() == name && !benchmark.HasFailed())
+                        {
+                            return &benchmark;
+                        }
+                    }
+                }
+
+                return nullptr;
+            }
+        }
+
+        //------------------------------------------------------------------------------
+        std::vector<Delta> Compare(const BenchmarkReport& baseline, const BenchmarkReport& current, double regressionThreshold, double significanceLevel) noexcept
+        {
+            std::vector<Delta> deltas;
+
+            for (const auto& benchmarkGroup : current.GetBenchmarkGroups())
+            {
+                for (const auto& benchmark : benchmarkGroup.GetBenchmarks())
+                {
+                    auto baselineBenchmark = FindBenchmark(baseline, benchmarkGroup.GetName(), benchmark.GetName());
+                    if (benchmark.HasFailed() || !baselineBenchmark)
+                    {
+                        continue;
+                    }
+
+                    Delta delta;
+                    delta.m_groupName = benchmarkGroup.GetName();
+                    delta.m_name = benchmark.GetName();
+                    delta.m_baselineTime = baselineBenchmark->GetTimePerIteration();
+                    delta.m_currentTime = benchmark.GetTimePerIteration();
+                    delta.m_change = (delta.m_baselineTime > 0.0) ? (delta.m_currentTime - delta.m_baselineTime) / delta.m_baselineTime : 0.0;
+                    delta.m_pValue = MannWhitneyUTest(GetTimesPerIteration(*baselineBenchmark), GetTimesPerIteration(benchmark));
+                    delta.m_isSignificant = (delta.m_pValue < significanceLevel);
+                    delta.m_isRegression = delta.m_isSignificant && delta.m_change > regressionThreshold;
+
+                    deltas.push_back(delta);
+                }
+            }
+
+            return deltas;
+        }
+    }
+}
\ No newline at end of file
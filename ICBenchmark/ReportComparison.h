@@ -0,0 +1,103 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_REPORTCOMPARISON_H_
+#define _ICBENCHMARK_REPORTCOMPARISON_H_
+
+#include "ForwardDeclarations.h"
+
+#include <string>
+#include <vector>
+
+namespace IC
+{
+    /// A container for functions which compare a benchmark report against a
+    /// baseline report, typically one taken with a previous version of
+    /// ICMemory.
+    ///
+    /// This is thread-safe.
+    ///
+    namespace ReportComparison
+    {
+        /// The change in a single benchmark between the baseline and current
+        /// reports. Times are per iteration, so reports calibrated to different
+        /// iteration counts can still be compared.
+        ///
+        struct Delta final
+        {
+            /// The name of the benchmark group.
+            ///
+            std::string m_groupName;
+
+            /// The name of the benchmark.
+            ///
+            std::string m_name;
+
+            /// The median time per iteration in the baseline, in nanoseconds.
+            ///
+            double m_baselineTime = 0.0;
+
+            /// The median time per iteration in the current report, in
+            /// nanoseconds.
+            ///
+            double m_currentTime = 0.0;
+
+            /// The relative change in time, where 0.1 is 10% slower.
+            ///
+            double m_change = 0.0;
+
+            /// The two-sided p-value of a Mann-Whitney U test on the per
+            /// iteration samples of the two reports.
+            ///
+            double m_pValue = 1.0;
+
+            /// Whether or not the change is statistically significant.
+            ///
+            bool m_isSignificant = false;
+
+            /// Whether or not the benchmark is significantly slower by more than
+            /// the regression threshold.
+            ///
+            bool m_isRegression = false;
+        };
+
+        /// Compares every successful benchmark in the current report with the
+        /// benchmark of the same group and name in the baseline. Benchmarks that
+        /// don't exist or failed in either report are omitted.
+        ///
+        /// @param baseline
+        ///        The baseline report.
+        /// @param current
+        ///        The current report.
+        /// @param regressionThreshold
+        ///        The relative slowdown, for example 0.05 for 5%, above which a
+        ///        significant change is considered a regression.
+        /// @param significanceLevel
+        ///        The p-value below which a change is considered significant.
+        ///
+        /// @return The delta for each benchmark, in the current report's order.
+        ///
+        std::vector<Delta> Compare(const BenchmarkReport& baseline, const BenchmarkReport& current, double regressionThreshold, double significanceLevel = 0.05) noexcept;
+    }
+}
+
+#endif
\ No newline at end of file
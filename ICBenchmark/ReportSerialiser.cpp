@@ -0,0 +1,638 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "ReportSerialiser.h"
+
+#include "BenchmarkReport.h"
+#include "CycleClock.h"
+#include "JsonValue.h"
+
+#include <array>
+#include <iomanip>
+#include <sstream>
+
+namespace IC
+{
+    namespace ReportSerialiser
+    {
+        namespace
+        {
+            constexpr std::uint64_t k_formatVersion = 1;
+
+            const double k_percentiles[] = { 50.0, 90.0, 99.0, 99.9 };
+            const char* k_percentileNames[] = { "p50", "p90", "p99", "p99.9" };
+
+            /// Writes the percentiles of the given latency histogram as a JSON
+            /// object, in nanoseconds.
+            ///
+            /// @param latencies
+            ///        The histogram, in CycleClock ticks.
+            /// @param stream
+            ///        The output stream.
+            ///
+            void WriteLatencies(const LatencyHistogram& latencies, std::ostream& stream) noexcept
+            {
+                stream << "{ \"count\": " << latencies.GetCount();
+                for (std::size_t i = 0; i < sizeof(k_percentiles) / sizeof(k_percentiles[0]); ++i)
+                {
+                    stream << ", " << JsonValue::Quote(k_percentileNames[i]) << ": " << CycleClock::ToNanoseconds(latencies.GetPercentile(k_percentiles[i]));
+                }
+                stream << ", \"max\": " << CycleClock::ToNanoseconds(latencies.GetMax()) << " }";
+            }
+
+            /// Writes the given resource usage as a JSON object.
+            ///
+            /// @param usage
+            ///        The resource usage.
+            /// @param stream
+            ///        The output stream.
+            ///
+            void WriteResourceUsage(const ResourceUsage& usage, std::ostream& stream) noexcept
+            {
+                stream << "{ \"available\": " << (usage.m_available ? "true" : "false") << ", \"runs\": " << usage.m_numWindows << ", \"userTime\": " << usage.m_userTime
+                    << ", \"systemTime\": " << usage.m_systemTime << ", \"minorPageFaults\": " << usage.m_minorPageFaults << ", \"majorPageFaults\": " << usage.m_majorPageFaults
+                    << ", \"voluntaryContextSwitches\": " << usage.m_voluntaryContextSwitches << ", \"involuntaryContextSwitches\": " << usage.m_involuntaryContextSwitches
+                    << ", \"peakResidentGrowth\": " << usage.m_peakResidentGrowth << ", \"retainedResidentGrowth\": " << usage.m_retainedResidentGrowth << " }";
+            }
+
+            /// Writes the given soak snapshot as a JSON object.
+            ///
+            /// @param snapshot
+            ///        The snapshot.
+            /// @param stream
+            ///        The output stream.
+            ///
+            void WriteSnapshot(const SoakSnapshot& snapshot, std::ostream& stream) noexcept
+            {
+                stream << "{ \"time\": " << snapshot.m_time << ", \"operations\": " << snapshot.m_numOperations << ", \"operationsPerSecond\": "
+                    << snapshot.m_operationsPerSecond << ", \"liveBytes\": " << snapshot.m_liveBytes << ", \"reservedBytes\": " << snapshot.m_reservedBytes
+                    << ", \"largestAllocation\": " << snapshot.m_largestAllocation << ", \"residentBytes\": " << snapshot.m_residentBytes << " }";
+            }
+
+            /// Writes a single benchmark as a JSON object.
+            ///
+            /// @param benchmark
+            ///        The benchmark.
+            /// @param stream
+            ///        The output stream.
+            ///
+            void WriteBenchmark(const BenchmarkReport::Benchmark& benchmark, std::ostream& stream) noexcept
+            {
+                stream << "        {\n";
+                stream << "          \"name\": " << JsonValue::Quote(benchmark.GetName()) << ",\n";
+
+                stream << "          \"parameters\": {";
+                const auto& parameters = benchmark.GetParameters().GetParameters();
+                for (std::size_t i = 0; i < parameters.size(); ++i)
+                {
+                    stream << (i > 0 ? ", " : " ") << JsonValue::Quote(parameters[i].first) << ": " << parameters[i].second;
+                }
+                stream << (parameters.empty() ? "},\n" : " },\n");
+
+                if (benchmark.HasFailed())
+                {
+                    stream << "          \"error\": " << JsonValue::Quote(benchmark.GetError()) << "\n";
+                    stream << "        }";
+                    return;
+                }
+
+                const auto& statistics = benchmark.GetStatistics();
+
+                stream << "          \"iterations\": " << benchmark.GetNumIterations() << ",\n";
+                stream << "          \"operations\": " << benchmark.GetNumOperations() << ",\n";
+                stream << "          \"allocatedBytes\": " << benchmark.GetNumAllocatedBytes() << ",\n";
+
+                stream << "          \"samples\": [";
+                const auto& samples = benchmark.GetSamples();
+                for (std::size_t i = 0; i < samples.size(); ++i)
+                {
+                    stream << (i > 0 ? ", " : " ") << samples[i];
+                }
+                stream << " ],\n";
+
+                stream << "          \"statistics\": { \"min\": " << statistics.GetMin() << ", \"max\": " << statistics.GetMax() << ", \"median\": " << statistics.GetMedian()
+                    << ", \"mean\": " << statistics.GetMean() << ", \"standardDeviation\": " << statistics.GetStandardDeviation() << ", \"confidenceInterval\": "
+                    << statistics.GetConfidenceInterval() << " },\n";
+                stream << "          \"timePerIteration\": " << benchmark.GetTimePerIteration() << ",\n";
+                stream << "          \"timePerOperation\": " << benchmark.GetTimePerOperation() << ",\n";
+                stream << "          \"operationsPerSecond\": " << benchmark.GetOperationsPerSecond() << ",\n";
+                stream << "          \"allocatedBytesPerSecond\": " << benchmark.GetAllocatedBytesPerSecond() << ",\n";
+
+                stream << "          \"performanceCounters\": {";
+                const auto& counters = benchmark.GetPerformanceCounters();
+                auto first = true;
+                for (std::size_t i = 0; i < PerformanceCounterValues::k_numCounters; ++i)
+                {
+                    auto counter = static_cast<PerformanceCounter>(i);
+                    if (counters.IsAvailable(counter))
+                    {
+                        stream << (first ? " " : ", ") << JsonValue::Quote(PerformanceCounterValues::GetName(counter)) << ": " << counters.GetValue(counter);
+                        first = false;
+                    }
+                }
+                stream << (first ? "},\n" : " },\n");
+
+                stream << "          \"performanceCounterTimes\": {";
+                first = true;
+                for (std::size_t i = 0; i < PerformanceCounterValues::k_numCounters; ++i)
+                {
+                    auto counter = static_cast<PerformanceCounter>(i);
+                    if (counters.GetTimeEnabled(counter) > 0)
+                    {
+                        stream << (first ? " " : ", ") << JsonValue::Quote(PerformanceCounterValues::GetName(counter)) << ": { \"enabled\": " << counters.GetTimeEnabled(counter)
+                            << ", \"running\": " << counters.GetTimeRunning(counter) << " }";
+                        first = false;
+                    }
+                }
+                stream << (first ? "},\n" : " },\n");
+
+                stream << "          \"resourceUsage\": ";
+                WriteResourceUsage(benchmark.GetResourceUsage(), stream);
+                stream << ",\n";
+
+                stream << "          \"threadTimes\": [";
+                const auto& threadTimes = benchmark.GetThreadTimes();
+                for (std::size_t i = 0; i < threadTimes.size(); ++i)
+                {
+                    stream << (i > 0 ? ", " : " ") << threadTimes[i];
+                }
+                stream << (threadTimes.empty() ? "],\n" : " ],\n");
+                stream << "          \"threadImbalance\": " << benchmark.GetThreadImbalance() << ",\n";
+
+                stream << "          \"counters\": {";
+                auto userCounters = benchmark.GetCounters();
+                first = true;
+                for (const auto& counter : userCounters)
+                {
+                    stream << (first ? " " : ", ") << JsonValue::Quote(counter.first) << ": " << counter.second;
+                    first = false;
+                }
+                stream << (first ? "},\n" : " },\n");
+
+                stream << "          \"snapshots\": [";
+                const auto& snapshots = benchmark.GetSnapshots();
+                for (std::size_t i = 0; i < snapshots.size(); ++i)
+                {
+                    stream << (i > 0 ? ",\n            " : "\n            ");
+                    WriteSnapshot(snapshots[i], stream);
+                }
+                stream << (snapshots.empty() ? "],\n" : "\n          ],\n");
+
+                stream << "          \"allocationLatencies\": ";
+                WriteLatencies(benchmark.GetAllocationLatencies(), stream);
+                stream << ",\n";
+
+                stream << "          \"deallocationLatencies\": ";
+                WriteLatencies(benchmark.GetDeallocationLatencies(), stream);
+                stream << "\n";
+
+                stream << "        }";
+            }
+
+            /// Quotes the given CSV field if it contains any special characters.
+            ///
+            /// @param field
+            ///        The field.
+            ///
+            /// @return The escaped field.
+            ///
+            std::string EscapeCsv(const std::string& field) noexcept
+            {
+                if (field.find_first_of(",\"\r\n") == std::string::npos)
+                {
+                    return field;
+                }
+
+                std::string escaped = "\"";
+                for (auto character : field)
+                {
+                    escaped += character;
+                    if (character == '"')
+                    {
+                        escaped += '"';
+                    }
+                }
+
+                escaped += "\"";
+                return escaped;
+            }
+
+            /// @param object
+            ///        A JSON object.
+            /// @param name
+            ///        The name of the member.
+            ///
+            /// @return The named member as an unsigned integer, or zero if it is
+            /// absent.
+            ///
+            std::uint64_t ReadUnsigned(const JsonValue& object, const std::string& name) noexcept
+            {
+                auto member = object.GetMember(name);
+                return member ? member->GetUnsigned() : 0;
+            }
+
+            /// Reads resource usage written with WriteResourceUsage().
+            ///
+            /// @param object
+            ///        The JSON object.
+            ///
+            /// @return The resource usage.
+            ///
+            ResourceUsage ReadResourceUsage(const JsonValue& object) noexcept
+            {
+                ResourceUsage usage;
+
+                auto available = object.GetMember("available");
+                usage.m_available = available && available->GetBool();
+                usage.m_numWindows = ReadUnsigned(object, "runs");
+                usage.m_userTime = ReadUnsigned(object, "userTime");
+                usage.m_systemTime = ReadUnsigned(object, "systemTime");
+                usage.m_minorPageFaults = ReadUnsigned(object, "minorPageFaults");
+                usage.m_majorPageFaults = ReadUnsigned(object, "majorPageFaults");
+                usage.m_voluntaryContextSwitches = ReadUnsigned(object, "voluntaryContextSwitches");
+                usage.m_involuntaryContextSwitches = ReadUnsigned(object, "involuntaryContextSwitches");
+                usage.m_peakResidentGrowth = ReadUnsigned(object, "peakResidentGrowth");
+
+                auto retained = object.GetMember("retainedResidentGrowth");
+                usage.m_retainedResidentGrowth = retained ? static_cast<std::int64_t>(retained->GetNumber()) : 0;
+
+                return usage;
+            }
+
+            /// Reads a soak snapshot written with WriteSnapshot().
+            ///
+            /// @param object
+            ///        The JSON object.
+            ///
+            /// @return The snapshot.
+            ///
+            SoakSnapshot ReadSnapshot(const JsonValue& object) noexcept
+            {
+                SoakSnapshot snapshot;
+                snapshot.m_time = ReadUnsigned(object, "time");
+                snapshot.m_numOperations = ReadUnsigned(object, "operations");
+                snapshot.m_liveBytes = ReadUnsigned(object, "liveBytes");
+                snapshot.m_reservedBytes = ReadUnsigned(object, "reservedBytes");
+                snapshot.m_largestAllocation = ReadUnsigned(object, "largestAllocation");
+                snapshot.m_residentBytes = ReadUnsigned(object, "residentBytes");
+
+                auto operationsPerSecond = object.GetMember("operationsPerSecond");
+                snapshot.m_operationsPerSecond = operationsPerSecond ? operationsPerSecond->GetNumber() : 0.0;
+
+                return snapshot;
+            }
+
+            /// Reads a benchmark written with WriteBenchmark().
+            ///
+            /// @param object
+            ///        The JSON object.
+            /// @param out_benchmarks
+            ///        (Out) The list which the benchmark is appended to.
+            ///
+            /// @return Whether or not the object was a valid benchmark.
+            ///
+            bool ReadBenchmark(const JsonValue& object, std::vector<BenchmarkReport::Benchmark>& out_benchmarks) noexcept
+            {
+                auto name = object.GetMember("name");
+                if (!name || name->GetType() != JsonValue::Type::k_string)
+                {
+                    return false;
+                }
+
+                std::vector<BenchmarkParameters::Parameter> parameterValues;
+                auto parametersObject = object.GetMember("parameters");
+                if (parametersObject)
+                {
+                    for (const auto& parameter : parametersObject->GetMembers())
+                    {
+                        parameterValues.emplace_back(parameter.first, parameter.second.GetUnsigned());
+                    }
+                }
+                BenchmarkParameters parameters(parameterValues);
+
+                auto error = object.GetMember("error");
+                if (error)
+                {
+                    out_benchmarks.push_back(BenchmarkReport::Benchmark(name->GetString(), error->GetString(), parameters));
+                    return true;
+                }
+
+                auto samples = object.GetMember("samples");
+                if (!samples || samples->GetElements().empty())
+                {
+                    return false;
+                }
+
+                BenchmarkMeasurement measurement;
+                measurement.m_numIterations = ReadUnsigned(object, "iterations");
+                measurement.m_numOperations = ReadUnsigned(object, "operations");
+                measurement.m_numAllocatedBytes = ReadUnsigned(object, "allocatedBytes");
+                if (measurement.m_numIterations == 0)
+                {
+                    return false;
+                }
+
+                for (const auto& sample : samples->GetElements())
+                {
+                    measurement.m_samples.push_back(sample.GetUnsigned());
+                }
+
+                auto counters = object.GetMember("performanceCounters");
+                if (counters)
+                {
+                    auto counterTimes = object.GetMember("performanceCounterTimes");
+
+                    std::array<std::uint64_t, PerformanceCounterValues::k_numCounters> values;
+                    std::array<bool, PerformanceCounterValues::k_numCounters> available;
+                    std::array<std::uint64_t, PerformanceCounterValues::k_numCounters> timesEnabled;
+                    std::array<std::uint64_t, PerformanceCounterValues::k_numCounters> timesRunning;
+                    for (std::size_t i = 0; i < PerformanceCounterValues::k_numCounters; ++i)
+                    {
+                        auto name = PerformanceCounterValues::GetName(static_cast<PerformanceCounter>(i));
+                        auto value = counters->GetMember(name);
+                        available[i] = (value != nullptr);
+                        values[i] = value ? value->GetUnsigned() : 0;
+
+                        auto times = counterTimes ? counterTimes->GetMember(name) : nullptr;
+                        timesEnabled[i] = times ? ReadUnsigned(*times, "enabled") : 0;
+                        timesRunning[i] = times ? ReadUnsigned(*times, "running") : 0;
+                    }
+                    measurement.m_performanceCounters = PerformanceCounterValues(values, available, timesEnabled, timesRunning);
+                }
+
+                auto threadTimes = object.GetMember("threadTimes");
+                if (threadTimes)
+                {
+                    for (const auto& threadTime : threadTimes->GetElements())
+                    {
+                        measurement.m_threadTimes.push_back(threadTime.GetUnsigned());
+                    }
+                }
+
+                auto resourceUsage = object.GetMember("resourceUsage");
+                if (resourceUsage)
+                {
+                    measurement.m_resourceUsage = ReadResourceUsage(*resourceUsage);
+                }
+
+                auto userCounters = object.GetMember("counters");
+                if (userCounters)
+                {
+                    auto numSamples = static_cast<double>(measurement.m_samples.size());
+                    for (const auto& counter : userCounters->GetMembers())
+                    {
+                        measurement.m_counters[counter.first] = counter.second.GetNumber() * numSamples;
+                    }
+                }
+
+                auto snapshots = object.GetMember("snapshots");
+                if (snapshots)
+                {
+                    for (const auto& snapshot : snapshots->GetElements())
+                    {
+                        measurement.m_snapshots.push_back(ReadSnapshot(snapshot));
+                    }
+                }
+
+                out_benchmarks.push_back(BenchmarkReport::Benchmark(name->GetString(), measurement, parameters));
+                return true;
+            }
+        }
+
+        //------------------------------------------------------------------------------
+        std::string ToJson(const BenchmarkReport& report) noexcept
+        {
+            std::ostringstream stream;
+            stream << std::setprecision(15);
+
+            const auto& environment = report.GetEnvironment();
+
+            stream << "{\n";
+            stream << "  \"format\": " << k_formatVersion << ",\n";
+            stream << "  \"environment\": {\n";
+            stream << "    \"timestamp\": " << JsonValue::Quote(environment.m_timestamp) << ",\n";
+            stream << "    \"hostName\": " << JsonValue::Quote(environment.m_hostName) << ",\n";
+            stream << "    \"operatingSystem\": " << JsonValue::Quote(environment.m_operatingSystem) << ",\n";
+            stream << "    \"cpuModel\": " << JsonValue::Quote(environment.m_cpuModel) << ",\n";
+            stream << "    \"numCpus\": " << environment.m_numCpus << ",\n";
+            stream << "    \"compiler\": " << JsonValue::Quote(environment.m_compiler) << ",\n";
+            stream << "    \"buildFlags\": " << JsonValue::Quote(environment.m_buildFlags) << ",\n";
+            stream << "    \"gitRevision\": " << JsonValue::Quote(environment.m_gitRevision) << ",\n";
+            stream << "    \"cpuAffinity\": " << JsonValue::Quote(environment.m_cpuAffinity) << ",\n";
+            stream << "    \"schedulingPolicy\": " << JsonValue::Quote(environment.m_schedulingPolicy) << ",\n";
+            stream << "    \"frequencyGovernor\": " << JsonValue::Quote(environment.m_frequencyGovernor) << ",\n";
+            stream << "    \"turboBoost\": " << JsonValue::Quote(environment.m_turboBoost) << "\n";
+            stream << "  },\n";
+
+            const auto& overhead = report.GetHarnessOverhead();
+            if (overhead.m_available)
+            {
+                stream << "  \"harnessOverhead\": { \"timer\": " << overhead.m_timerOverhead << ", \"iteration\": " << overhead.m_iterationOverhead << ", \"dispatch\": "
+                    << overhead.m_dispatchOverhead << ", \"noiseFloor\": " << overhead.m_noiseFloor << ", \"subtracted\": " << (overhead.m_subtracted ? "true" : "false") << " },\n";
+            }
+
+            stream << "  \"groups\": [";
+
+            const auto& benchmarkGroups = report.GetBenchmarkGroups();
+            for (std::size_t i = 0; i < benchmarkGroups.size(); ++i)
+            {
+                stream << (i > 0 ? ",\n" : "\n");
+                stream << "    {\n";
+                stream << "      \"name\": " << JsonValue::Quote(benchmarkGroups[i].GetName()) << ",\n";
+                stream << "      \"benchmarks\": [";
+
+                const auto& benchmarks = benchmarkGroups[i].GetBenchmarks();
+                for (std::size_t j = 0; j < benchmarks.size(); ++j)
+                {
+                    stream << (j > 0 ? ",\n" : "\n");
+                    WriteBenchmark(benchmarks[j], stream);
+                }
+
+                stream << "\n      ]\n";
+                stream << "    }";
+            }
+
+            stream << "\n  ]\n";
+            stream << "}\n";
+
+            return stream.str();
+        }
+
+        //------------------------------------------------------------------------------
+        std::string ToCsv(const BenchmarkReport& report) noexcept
+        {
+            std::ostringstream stream;
+            stream << std::setprecision(15);
+
+            stream << "group,benchmark,error,iterations,operations,allocated_bytes,min_ns,max_ns,median_ns,mean_ns,stddev_ns,ci95_ns,ns_per_iteration,ns_per_operation,operations_per_second,allocated_bytes_per_second";
+            for (std::size_t i = 0; i < PerformanceCounterValues::k_numCounters; ++i)
+            {
+                stream << "," << PerformanceCounterValues::GetName(static_cast<PerformanceCounter>(i));
+            }
+            for (std::size_t i = 0; i < PerformanceCounterValues::k_numCounters; ++i)
+            {
+                auto name = PerformanceCounterValues::GetName(static_cast<PerformanceCounter>(i));
+                stream << "," << name << " enabled_ns," << name << " running_ns";
+            }
+            stream << ",user_time_ns,system_time_ns,minor_page_faults,major_page_faults,voluntary_context_switches,involuntary_context_switches,peak_rss_growth_bytes,"
+                "retained_rss_growth_bytes,thread_imbalance,samples_ns,counters\n";
+
+            for (const auto& benchmarkGroup : report.GetBenchmarkGroups())
+            {
+                for (const auto& benchmark : benchmarkGroup.GetBenchmarks())
+                {
+                    const auto& statistics = benchmark.GetStatistics();
+                    const auto& counters = benchmark.GetPerformanceCounters();
+                    const auto& usage = benchmark.GetResourceUsage();
+
+                    stream << EscapeCsv(benchmarkGroup.GetName()) << "," << EscapeCsv(benchmark.GetName()) << "," << EscapeCsv(benchmark.GetError()) << ","
+                        << benchmark.GetNumIterations() << "," << benchmark.GetNumOperations() << "," << benchmark.GetNumAllocatedBytes() << "," << statistics.GetMin() << "," << statistics.GetMax() << ","
+                        << statistics.GetMedian() << "," << statistics.GetMean() << "," << statistics.GetStandardDeviation() << "," << statistics.GetConfidenceInterval() << ","
+                        << benchmark.GetTimePerIteration() << "," << benchmark.GetTimePerOperation() << "," << benchmark.GetOperationsPerSecond() << ","
+                        << benchmark.GetAllocatedBytesPerSecond();
+
+                    for (std::size_t i = 0; i < PerformanceCounterValues::k_numCounters; ++i)
+                    {
+                        auto counter = static_cast<PerformanceCounter>(i);
+                        stream << ",";
+                        if (counters.IsAvailable(counter))
+                        {
+                            stream << counters.GetValue(counter);
+                        }
+                    }
+
+                    for (std::size_t i = 0; i < PerformanceCounterValues::k_numCounters; ++i)
+                    {
+                        auto counter = static_cast<PerformanceCounter>(i);
+                        stream << "," << counters.GetTimeEnabled(counter) << "," << counters.GetTimeRunning(counter);
+                    }
+
+                    stream << "," << usage.m_userTime << "," << usage.m_systemTime << "," << usage.m_minorPageFaults << "," << usage.m_majorPageFaults << ","
+                        << usage.m_voluntaryContextSwitches << "," << usage.m_involuntaryContextSwitches << "," << usage.m_peakResidentGrowth << ","
+                        << usage.m_retainedResidentGrowth << "," << benchmark.GetThreadImbalance() << ",";
+
+                    const auto& samples = benchmark.GetSamples();
+                    for (std::size_t i = 0; i < samples.size(); ++i)
+                    {
+                        stream << (i > 0 ? ";" : "") << samples[i];
+                    }
+                    stream << ",";
+
+                    auto first = true;
+                    for (const auto& counter : benchmark.GetCounters())
+                    {
+                        stream << (first ? "" : ";") << EscapeCsv(counter.first) << "=" << counter.second;
+                        first = false;
+                    }
+                    stream << "\n";
+                }
+            }
+
+            return stream.str();
+        }
+
+        //------------------------------------------------------------------------------
+        bool FromJson(const std::string& json, BenchmarkReport& out_report) noexcept
+        {
+            JsonValue document;
+            if (!JsonValue::Parse(json, document) || ReadUnsigned(document, "format") != k_formatVersion)
+            {
+                return false;
+            }
+
+            BenchmarkEnvironment environment;
+            auto environmentObject = document.GetMember("environment");
+            if (environmentObject)
+            {
+                auto readString = [&environmentObject](const std::string& name)
+                {
+                    auto member = environmentObject->GetMember(name);
+                    return member ? member->GetString() : std::string();
+                };
+
+                environment.m_timestamp = readString("timestamp");
+                environment.m_hostName = readString("hostName");
+                environment.m_operatingSystem = readString("operatingSystem");
+                environment.m_cpuModel = readString("cpuModel");
+                environment.m_numCpus = static_cast<std::uint32_t>(ReadUnsigned(*environmentObject, "numCpus"));
+                environment.m_compiler = readString("compiler");
+                environment.m_buildFlags = readString("buildFlags");
+                environment.m_gitRevision = readString("gitRevision");
+                environment.m_cpuAffinity = readString("cpuAffinity");
+                environment.m_schedulingPolicy = readString("schedulingPolicy");
+                environment.m_frequencyGovernor = readString("frequencyGovernor");
+                environment.m_turboBoost = readString("turboBoost");
+            }
+
+            HarnessOverhead overhead;
+            auto overheadObject = document.GetMember("harnessOverhead");
+            if (overheadObject)
+            {
+                auto readNumber = [&overheadObject](const std::string& name)
+                {
+                    auto member = overheadObject->GetMember(name);
+                    return member ? member->GetNumber() : 0.0;
+                };
+
+                auto subtracted = overheadObject->GetMember("subtracted");
+
+                overhead.m_available = true;
+                overhead.m_timerOverhead = readNumber("timer");
+                overhead.m_iterationOverhead = readNumber("iteration");
+                overhead.m_dispatchOverhead = readNumber("dispatch");
+                overhead.m_noiseFloor = readNumber("noiseFloor");
+                overhead.m_subtracted = subtracted && subtracted->GetBool();
+            }
+
+            auto groups = document.GetMember("groups");
+            if (!groups || groups->GetType() != JsonValue::Type::k_array)
+            {
+                return false;
+            }
+
+            std::vector<BenchmarkReport::BenchmarkGroup> benchmarkGroups;
+            for (const auto& group : groups->GetElements())
+            {
+                auto name = group.GetMember("name");
+                auto benchmarks = group.GetMember("benchmarks");
+                if (!name || !benchmarks)
+                {
+                    return false;
+                }
+
+                std::vector<BenchmarkReport::Benchmark> benchmarkReports;
+                for (const auto& benchmark : benchmarks->GetElements())
+                {
+                    if (!ReadBenchmark(benchmark, benchmarkReports))
+                    {
+                        return false;
+                    }
+                }
+
+                benchmarkGroups.push_back(BenchmarkReport::BenchmarkGroup(name->GetString(), benchmarkReports));
+            }
+
+            out_report = BenchmarkReport(benchmarkGroups, environment, overhead);
+            return true;
+        }
+    }
+}
\ No newline at end of file
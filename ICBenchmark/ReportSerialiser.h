@@ -0,0 +1,76 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_REPORTSERIALISER_H_
+#define _ICBENCHMARK_REPORTSERIALISER_H_
+
+#include "ForwardDeclarations.h"
+
+#include <string>
+
+namespace IC
+{
+    /// A container for functions which convert benchmark reports to and from
+    /// machine readable formats, so that results can be archived, processed by
+    /// other tools, or loaded back as a baseline for later comparison.
+    ///
+    /// This is thread-safe.
+    ///
+    namespace ReportSerialiser
+    {
+        /// Serialises the given report to JSON. This includes the environment
+        /// metadata, every sample, the derived statistics and any performance
+        /// counters, resource usage and latency percentiles that were recorded.
+        ///
+        /// @param report
+        ///        The report to serialise.
+        ///
+        /// @return The JSON document.
+        ///
+        std::string ToJson(const BenchmarkReport& report) noexcept;
+
+        /// Serialises the given report to CSV, with a header row followed by
+        /// one row per benchmark. Samples are listed in a single column,
+        /// separated by semicolons.
+        ///
+        /// @param report
+        ///        The report to serialise.
+        ///
+        /// @return The CSV document.
+        ///
+        std::string ToCsv(const BenchmarkReport& report) noexcept;
+
+        /// Reads a report previously written with ToJson(). Latency histograms
+        /// are only stored as percentiles, so are not restored.
+        ///
+        /// @param json
+        ///        The JSON document.
+        /// @param out_report
+        ///        (Out) The report. Only modified if reading succeeds.
+        ///
+        /// @return Whether or not the document was a valid report.
+        ///
+        bool FromJson(const std::string& json, BenchmarkReport& out_report) noexcept;
+    }
+}
+
+#endif
\ No newline at end of file
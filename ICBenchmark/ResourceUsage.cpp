@@ -0,0 +1,240 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "ResourceUsage.h"
+
+#include <algorithm>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define IC_RESOURCEUSAGE_SUPPORTED
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#endif
+
+namespace IC
+{
+    namespace
+    {
+#if defined(IC_RESOURCEUSAGE_SUPPORTED)
+        /// @param time
+        ///        A time value.
+        ///
+        /// @return The given time in nanoseconds.
+        ///
+        std::uint64_t ToNanoseconds(const timeval& time) noexcept
+        {
+            return static_cast<std::uint64_t>(time.tv_sec) * 1000000000 + static_cast<std::uint64_t>(time.tv_usec) * 1000;
+        }
+
+        /// Reads the cumulative resource usage of the process.
+        ///
+        /// @param out_usage
+        ///        (Out) The usage. Resident sizes are not filled in.
+        ///
+        /// @return Whether or not the usage could be read.
+        ///
+        bool ReadProcessUsage(ResourceUsage& out_usage) noexcept
+        {
+            rusage usage;
+            if (getrusage(RUSAGE_SELF, &usage) != 0)
+            {
+                return false;
+            }
+
+            out_usage.m_userTime = ToNanoseconds(usage.ru_utime);
+            out_usage.m_systemTime = ToNanoseconds(usage.ru_stime);
+            out_usage.m_minorPageFaults = static_cast<std::uint64_t>(usage.ru_minflt);
+            out_usage.m_majorPageFaults = static_cast<std::uint64_t>(usage.ru_majflt);
+            out_usage.m_voluntaryContextSwitches = static_cast<std::uint64_t>(usage.ru_nvcsw);
+            out_usage.m_involuntaryContextSwitches = static_cast<std::uint64_t>(usage.ru_nivcsw);
+            return true;
+        }
+
+        /// @return The current resident set size of the process in bytes, or
+        /// zero if it can't be read.
+        ///
+        std::uint64_t ReadResidentSize() noexcept
+        {
+#if defined(__linux__)
+            auto file = std::fopen("/proc/self/statm", "r");
+            if (!file)
+            {
+                return 0;
+            }
+
+            unsigned long long sizePages = 0;
+            unsigned long long residentPages = 0;
+            auto numRead = std::fscanf(file, "%llu %llu", &sizePages, &residentPages);
+            std::fclose(file);
+
+            if (numRead != 2)
+            {
+                return 0;
+            }
+
+            return static_cast<std::uint64_t>(residentPages) * static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE));
+#else
+            return 0;
+#endif
+        }
+
+        /// Resets the kernel's record of the peak resident set size to the
+        /// current size.
+        ///
+        /// @return Whether or not the reset succeeded.
+        ///
+        bool ResetPeakResidentSize() noexcept
+        {
+#if defined(__linux__)
+            auto file = std::fopen("/proc/self/clear_refs", "w");
+            if (!file)
+            {
+                return false;
+            }
+
+            auto success = std::fputs("5", file) >= 0;
+            success = (std::fclose(file) == 0) && success;
+            return success;
+#else
+            return false;
+#endif
+        }
+
+        /// @return The peak resident set size since it was last reset, in bytes,
+        /// or zero if it can't be read.
+        ///
+        std::uint64_t ReadPeakResidentSize() noexcept
+        {
+#if defined(__linux__)
+            auto file = std::fopen("/proc/self/status", "r");
+            if (!file)
+            {
+                return 0;
+            }
+
+            std::uint64_t peakResident = 0;
+            char line[256];
+            while (std::fgets(line, sizeof(line), file))
+            {
+                unsigned long long valueKb = 0;
+                if (std::sscanf(line, "VmHWM: %llu kB", &valueKb) == 1)
+                {
+                    peakResident = static_cast<std::uint64_t>(valueKb) * 1024;
+                    break;
+                }
+            }
+
+            std::fclose(file);
+            return peakResident;
+#else
+            return 0;
+#endif
+        }
+#endif
+    }
+
+    //------------------------------------------------------------------------------
+    double ResourceUsage::GetSystemTimeFraction() const noexcept
+    {
+        auto totalTime = m_userTime + m_systemTime;
+        if (totalTime == 0)
+        {
+            return 0.0;
+        }
+
+        return static_cast<double>(m_systemTime) / static_cast<double>(totalTime);
+    }
+
+    //------------------------------------------------------------------------------
+    void ResourceUsage::Merge(const ResourceUsage& other) noexcept
+    {
+        if (m_numWindows == 0)
+        {
+            *this = other;
+            return;
+        }
+
+        m_available = m_available && other.m_available;
+        m_numWindows += other.m_numWindows;
+        m_userTime += other.m_userTime;
+        m_systemTime += other.m_systemTime;
+        m_minorPageFaults += other.m_minorPageFaults;
+        m_majorPageFaults += other.m_majorPageFaults;
+        m_voluntaryContextSwitches += other.m_voluntaryContextSwitches;
+        m_involuntaryContextSwitches += other.m_involuntaryContextSwitches;
+        m_peakResidentGrowth = std::max(m_peakResidentGrowth, other.m_peakResidentGrowth);
+        m_retainedResidentGrowth += other.m_retainedResidentGrowth;
+    }
+
+    //------------------------------------------------------------------------------
+    void ResourceUsageTracker::Start() noexcept
+    {
+#if defined(IC_RESOURCEUSAGE_SUPPORTED)
+        m_peakReset = ResetPeakResidentSize();
+        m_startResident = ReadResidentSize();
+        m_start.m_available = ReadProcessUsage(m_start);
+#endif
+    }
+
+    //------------------------------------------------------------------------------
+    void ResourceUsageTracker::Stop() noexcept
+    {
+#if defined(IC_RESOURCEUSAGE_SUPPORTED)
+        ResourceUsage end;
+        if (!m_start.m_available || !ReadProcessUsage(end))
+        {
+            return;
+        }
+
+        auto endResident = ReadResidentSize();
+        auto peakResident = m_peakReset ? ReadPeakResidentSize() : endResident;
+
+        ResourceUsage window;
+        window.m_available = true;
+        window.m_numWindows = 1;
+        window.m_userTime = end.m_userTime - m_start.m_userTime;
+        window.m_systemTime = end.m_systemTime - m_start.m_systemTime;
+        window.m_minorPageFaults = end.m_minorPageFaults - m_start.m_minorPageFaults;
+        window.m_majorPageFaults = end.m_majorPageFaults - m_start.m_majorPageFaults;
+        window.m_voluntaryContextSwitches = end.m_voluntaryContextSwitches - m_start.m_voluntaryContextSwitches;
+        window.m_involuntaryContextSwitches = end.m_involuntaryContextSwitches - m_start.m_involuntaryContextSwitches;
+        window.m_peakResidentGrowth = (peakResident > m_startResident) ? peakResident - m_startResident : 0;
+        window.m_retainedResidentGrowth = static_cast<std::int64_t>(endResident) - static_cast<std::int64_t>(m_startResident);
+
+        m_resourceUsage.Merge(window);
+#endif
+    }
+
+    //------------------------------------------------------------------------------
+    std::uint64_t ResourceUsageTracker::GetResidentSize() noexcept
+    {
+#if defined(IC_RESOURCEUSAGE_SUPPORTED)
+        return ReadResidentSize();
+#else
+        return 0;
+#endif
+    }
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_RESOURCEUSAGE_H_
+#define _ICBENCHMARK_RESOURCEUSAGE_H_
+
+#include <cstdint>
+
+namespace IC
+{
+    /// A description of the operating system resources consumed by the process
+    /// over one or more measurement windows: CPU time split between user and
+    /// kernel space, page faults, context switches and resident memory.
+    ///
+    struct ResourceUsage final
+    {
+        /// Whether or not resource usage could be measured on this platform.
+        /// All other values are zero if not.
+        ///
+        bool m_available = false;
+
+        /// The number of measurement windows which were combined.
+        ///
+        std::uint64_t m_numWindows = 0;
+
+        /// The CPU time in nanoseconds spent in user space, across all threads.
+        ///
+        std::uint64_t m_userTime = 0;
+
+        /// The CPU time in nanoseconds spent in the kernel, across all threads.
+        ///
+        std::uint64_t m_systemTime = 0;
+
+        /// The number of page faults serviced without any I/O.
+        ///
+        std::uint64_t m_minorPageFaults = 0;
+
+        /// The number of page faults which required I/O.
+        ///
+        std::uint64_t m_majorPageFaults = 0;
+
+        /// The number of times a thread gave up the CPU voluntarily, for example
+        /// to wait on a lock.
+        ///
+        std::uint64_t m_voluntaryContextSwitches = 0;
+
+        /// The number of times a thread was preempted.
+        ///
+        std::uint64_t m_involuntaryContextSwitches = 0;
+
+        /// The largest growth in resident set size, in bytes, seen above the
+        /// size at the start of a window.
+        ///
+        std::uint64_t m_peakResidentGrowth = 0;
+
+        /// The total change in resident set size, in bytes, between the start
+        /// and end of each window. This is memory which was retained after the
+        /// measured work completed.
+        ///
+        std::int64_t m_retainedResidentGrowth = 0;
+
+        /// @return The fraction of CPU time spent in the kernel, in the range
+        /// [0, 1].
+        ///
+        double GetSystemTimeFraction() const noexcept;
+
+        /// Adds the windows described by the given usage to this one.
+        ///
+        /// @param other
+        ///        The usage to merge.
+        ///
+        void Merge(const ResourceUsage& other) noexcept;
+    };
+
+    /// Measures the resources used by the process between calls to Start() and
+    /// Stop(), accumulating over multiple windows. CPU time, page faults and
+    /// context switches are read with getrusage(), and resident memory from
+    /// /proc/self, so they cover every thread in the process.
+    ///
+    /// Peak resident growth relies on resetting the kernel's high water mark,
+    /// which is only possible on Linux; elsewhere only the retained growth is
+    /// reported. On platforms without getrusage() nothing is measured.
+    ///
+    /// This is not thread-safe.
+    ///
+    class ResourceUsageTracker final
+    {
+    public:
+        ResourceUsageTracker() = default;
+
+        /// Starts a measurement window.
+        ///
+        void Start() noexcept;
+
+        /// Stops the current measurement window and adds it to the total.
+        ///
+        void Stop() noexcept;
+
+        /// @return The usage accumulated over all completed windows.
+        ///
+        const ResourceUsage& GetResourceUsage() const noexcept { return m_resourceUsage; }
+
+        /// @return The current resident set size of the process in bytes, or
+        /// zero if it can't be read on this platform.
+        ///
+        static std::uint64_t GetResidentSize() noexcept;
+
+    private:
+        ResourceUsageTracker(const ResourceUsageTracker&) = delete;
+        ResourceUsageTracker& operator=(const ResourceUsageTracker&) = delete;
+
+        ResourceUsage m_start;
+        std::uint64_t m_startResident = 0;
+        bool m_peakReset = false;
+        ResourceUsage m_resourceUsage;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,70 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_SOAKSNAPSHOT_H_
+#define _ICBENCHMARK_SOAKSNAPSHOT_H_
+
+#include <cstdint>
+
+namespace IC
+{
+    /// The state of a soak benchmark at one point in its run. Soak benchmarks
+    /// record a snapshot every snapshot interval, building up a time series
+    /// which shows how the allocator behaves as it ages.
+    ///
+    struct SoakSnapshot final
+    {
+        /// The wall-clock time in nanoseconds since the soak started.
+        ///
+        std::uint64_t m_time = 0;
+
+        /// The total number of operations performed since the soak started.
+        ///
+        std::uint64_t m_numOperations = 0;
+
+        /// The number of operations performed per second of timed work since
+        /// the previous snapshot.
+        ///
+        double m_operationsPerSecond = 0.0;
+
+        /// The number of bytes allocated by the benchmark and not yet freed.
+        ///
+        std::uint64_t m_liveBytes = 0;
+
+        /// The number of bytes the allocator has reserved from its parent, or
+        /// zero if unknown.
+        ///
+        std::uint64_t m_reservedBytes = 0;
+
+        /// The size in bytes of the largest single allocation the allocator
+        /// could satisfy, or zero if unknown.
+        ///
+        std::uint64_t m_largestAllocation = 0;
+
+        /// The resident set size of the process in bytes, or zero if it can't
+        /// be read on this platform.
+        ///
+        std::uint64_t m_residentBytes = 0;
+    };
+}
+
+#endif
\ No newline at end of file
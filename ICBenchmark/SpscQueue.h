@@ -0,0 +1,130 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_SPSCQUEUE_H_
+#define _ICBENCHMARK_SPSCQUEUE_H_
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace IC
+{
+    /// A bounded, lock-free queue with a single producer thread and a single
+    /// consumer thread, used to hand objects between the threads of a
+    /// benchmark without the hand-off itself taking a lock.
+    ///
+    /// The producer and consumer indices are padded onto separate cache lines.
+    /// Padding is used rather than alignment so that queues can be allocated
+    /// with new. Each side caches the other's index so that it only reads the
+    /// shared value when the queue looks full or empty.
+    ///
+    /// Push() and Pop() spin, yielding, while the queue is full or empty.
+    ///
+    /// This is thread-safe provided there is only ever one thread pushing and
+    /// one thread popping.
+    ///
+    template <typename TValue> class SpscQueue final
+    {
+    public:
+        /// Creates a new, empty queue.
+        ///
+        /// @param capacity
+        ///        The number of values the queue can hold. Must be a power of
+        ///        two.
+        ///
+        SpscQueue(std::size_t capacity) noexcept
+            : m_values(capacity), m_mask(capacity - 1)
+        {
+            assert(capacity > 0 && (capacity & (capacity - 1)) == 0);
+        }
+
+        /// Adds a value to the back of the queue, waiting until there is room.
+        /// This must only be called from the producer thread.
+        ///
+        /// @param value
+        ///        The value to add.
+        ///
+        void Push(TValue value) noexcept
+        {
+            auto tail = m_tail.load(std::memory_order_relaxed);
+            while (tail - m_cachedHead == m_values.size())
+            {
+                m_cachedHead = m_head.load(std::memory_order_acquire);
+                if (tail - m_cachedHead == m_values.size())
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            m_values[tail & m_mask] = std::move(value);
+            m_tail.store(tail + 1, std::memory_order_release);
+        }
+
+        /// Removes the value at the front of the queue, waiting until there is
+        /// one. This must only be called from the consumer thread.
+        ///
+        /// @return The removed value.
+        ///
+        TValue Pop() noexcept
+        {
+            auto head = m_head.load(std::memory_order_relaxed);
+            while (head == m_cachedTail)
+            {
+                m_cachedTail = m_tail.load(std::memory_order_acquire);
+                if (head == m_cachedTail)
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            auto value = std::move(m_values[head & m_mask]);
+            m_head.store(head + 1, std::memory_order_release);
+            return value;
+        }
+
+    private:
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+
+        static constexpr std::size_t k_cacheLineSize = 64;
+
+        std::vector<TValue> m_values;
+        std::size_t m_mask;
+
+        std::uint8_t m_headPadding[k_cacheLineSize];
+        std::atomic<std::size_t> m_head{0};
+        std::size_t m_cachedTail = 0;
+
+        std::uint8_t m_tailPadding[k_cacheLineSize];
+        std::atomic<std::size_t> m_tail{0};
+        std::size_t m_cachedHead = 0;
+
+        std::uint8_t m_endPadding[k_cacheLineSize];
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,145 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Statistics.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace IC
+{
+    namespace
+    {
+        /// A tabulated critical value of the Student's t-distribution beyond the
+        /// first 30 degrees of freedom.
+        ///
+        struct SparseCriticalValue final
+        {
+            std::size_t m_degreesOfFreedom;
+            double m_criticalValue;
+        };
+
+        /// Returns the two-tailed 95% critical value of the Student's
+        /// t-distribution for the given degrees of freedom. Every value up to 30
+        /// degrees of freedom is tabulated. Beyond that, values are interpolated
+        /// linearly in 1 / degrees of freedom between 30, 40, 60 and 120, and
+        /// then towards the normal value of 1.960, which is the limit as the
+        /// degrees of freedom tend to infinity.
+        ///
+        /// @param degreesOfFreedom
+        ///        The degrees of freedom. Must be at least 1.
+        ///
+        /// @return The critical value.
+        ///
+        double GetTCriticalValue(std::size_t degreesOfFreedom) noexcept
+        {
+            constexpr double k_criticalValues[] =
+            {
+                12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+            };
+            constexpr std::size_t k_numCriticalValues = sizeof(k_criticalValues) / sizeof(k_criticalValues[0]);
+
+            constexpr SparseCriticalValue k_sparseCriticalValues[] =
+            {
+                { 30, 2.042 }, { 40, 2.021 }, { 60, 2.000 }, { 120, 1.980 }
+            };
+            constexpr std::size_t k_numSparseCriticalValues = sizeof(k_sparseCriticalValues) / sizeof(k_sparseCriticalValues[0]);
+            constexpr double k_normalCriticalValue = 1.960;
+
+            assert(degreesOfFreedom > 0);
+
+            if (degreesOfFreedom <= k_numCriticalValues)
+            {
+                return k_criticalValues[degreesOfFreedom - 1];
+            }
+
+            auto inverse = 1.0 / static_cast<double>(degreesOfFreedom);
+            for (std::size_t i = 1; i <= k_numSparseCriticalValues; ++i)
+            {
+                const auto& lower = k_sparseCriticalValues[i - 1];
+                auto lowerInverse = 1.0 / static_cast<double>(lower.m_degreesOfFreedom);
+
+                auto upperInverse = 0.0;
+                auto upperCriticalValue = k_normalCriticalValue;
+                if (i < k_numSparseCriticalValues)
+                {
+                    upperInverse = 1.0 / static_cast<double>(k_sparseCriticalValues[i].m_degreesOfFreedom);
+                    upperCriticalValue = k_sparseCriticalValues[i].m_criticalValue;
+                }
+
+                if (inverse >= upperInverse)
+                {
+                    auto t = (lowerInverse - inverse) / (lowerInverse - upperInverse);
+                    return lower.m_criticalValue + t * (upperCriticalValue - lower.m_criticalValue);
+                }
+            }
+
+            return k_normalCriticalValue;
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    Statistics::Statistics(const std::vector<std::uint64_t>& samples) noexcept
+        : m_numSamples(samples.size())
+    {
+        assert(!samples.empty());
+
+        auto sorted = samples;
+        std::sort(sorted.begin(), sorted.end());
+
+        m_min = static_cast<double>(sorted.front());
+        m_max = static_cast<double>(sorted.back());
+
+        auto middle = sorted.size() / 2;
+        if (sorted.size() % 2 == 0)
+        {
+            m_median = (static_cast<double>(sorted[middle - 1]) + static_cast<double>(sorted[middle])) / 2.0;
+        }
+        else
+        {
+            m_median = static_cast<double>(sorted[middle]);
+        }
+
+        double sum = 0.0;
+        for (auto sample : sorted)
+        {
+            sum += static_cast<double>(sample);
+        }
+        m_mean = sum / static_cast<double>(m_numSamples);
+
+        if (m_numSamples > 1)
+        {
+            double sumOfSquares = 0.0;
+            for (auto sample : sorted)
+            {
+                auto difference = static_cast<double>(sample) - m_mean;
+                sumOfSquares += difference * difference;
+            }
+
+            m_standardDeviation = std::sqrt(sumOfSquares / static_cast<double>(m_numSamples - 1));
+            m_confidenceInterval = GetTCriticalValue(m_numSamples - 1) * m_standardDeviation / std::sqrt(static_cast<double>(m_numSamples));
+        }
+    }
+}
\ No newline at end of file
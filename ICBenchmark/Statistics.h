@@ -0,0 +1,101 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_STATISTICS_H_
+#define _ICBENCHMARK_STATISTICS_H_
+
+#include <cstdint>
+#include <vector>
+
+namespace IC
+{
+    /// A summary of a series of time samples, describing both the typical value
+    /// and how much the samples vary. All values are in the same unit as the
+    /// samples they were calculated from.
+    ///
+    /// This is immutable and therefore thread-safe.
+    ///
+    class Statistics final
+    {
+    public:
+        Statistics() = default;
+
+        /// Calculates the statistics for the given samples.
+        ///
+        /// @param samples
+        ///        The samples. Must not be empty.
+        ///
+        Statistics(const std::vector<std::uint64_t>& samples) noexcept;
+
+        /// @return The number of samples the statistics were calculated from.
+        ///
+        std::size_t GetNumSamples() const noexcept { return m_numSamples; }
+
+        /// @return The smallest sample.
+        ///
+        double GetMin() const noexcept { return m_min; }
+
+        /// @return The largest sample.
+        ///
+        double GetMax() const noexcept { return m_max; }
+
+        /// @return The median sample. For an even number of samples this is the
+        /// mean of the two middle samples.
+        ///
+        double GetMedian() const noexcept { return m_median; }
+
+        /// @return The arithmetic mean of the samples.
+        ///
+        double GetMean() const noexcept { return m_mean; }
+
+        /// @return The sample standard deviation, or zero if there is only one
+        /// sample.
+        ///
+        double GetStandardDeviation() const noexcept { return m_standardDeviation; }
+
+        /// @return The half-width of the 95% confidence interval of the mean,
+        /// calculated using the Student's t-distribution. The interval is
+        /// therefore [mean - value, mean + value].
+        ///
+        double GetConfidenceInterval() const noexcept { return m_confidenceInterval; }
+
+        /// @return The lower bound of the 95% confidence interval of the mean.
+        /// Samples are never negative, so this is clamped at zero.
+        ///
+        double GetConfidenceIntervalMin() const noexcept { return (m_mean > m_confidenceInterval) ? m_mean - m_confidenceInterval : 0.0; }
+
+        /// @return The upper bound of the 95% confidence interval of the mean.
+        ///
+        double GetConfidenceIntervalMax() const noexcept { return m_mean + m_confidenceInterval; }
+
+    private:
+        std::size_t m_numSamples = 0;
+        double m_min = 0.0;
+        double m_max = 0.0;
+        double m_median = 0.0;
+        double m_mean = 0.0;
+        double m_standardDeviation = 0.0;
+        double m_confidenceInterval = 0.0;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,128 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "ThreadScaling.h"
+
+#include <algorithm>
+
+namespace IC
+{
+    namespace ThreadScaling
+    {
+        namespace
+        {
+            /// Returns the name of the given benchmark with its thread count
+            /// removed.
+            ///
+            /// @param benchmark
+            ///        The benchmark.
+            ///
+            /// @return The series name.
+            ///
+            std::string GetSeriesName(const BenchmarkReport::Benchmark& benchmark) noexcept
+            {
+                auto name = benchmark.GetName();
+                auto threadsComponent = "/" + std::string(k_threadsParameter) + ":" + std::to_string(benchmark.GetParameters().Get(k_threadsParameter));
+
+                auto position = name.find(threadsComponent);
+                if (position != std::string::npos)
+                {
+                    name.erase(position, threadsComponent.size());
+                }
+
+                return name;
+            }
+
+            /// @param benchmark
+            ///        The benchmark.
+            ///
+            /// @return Whether or not the benchmark has a thread count parameter.
+            ///
+            bool HasThreadsParameter(const BenchmarkReport::Benchmark& benchmark) noexcept
+            {
+                for (const auto& parameter : benchmark.GetParameters().GetParameters())
+                {
+                    if (parameter.first == k_threadsParameter)
+                    {
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+        }
+
+        //------------------------------------------------------------------------------
+        std::vector<Point> Analyse(const BenchmarkReport::BenchmarkGroup& benchmarkGroup) noexcept
+        {
+            std::vector<std::string> seriesOrder;
+            std::vector<Point> points;
+
+            for (const auto& benchmark : benchmarkGroup.GetBenchmarks())
+            {
+                if (benchmark.HasFailed() || benchmark.GetOperationsPerSecond() <= 0.0 || !HasThreadsParameter(benchmark))
+                {
+                    continue;
+                }
+
+                Point point;
+                point.m_series = GetSeriesName(benchmark);
+                point.m_numThreads = benchmark.GetParameters().Get(k_threadsParameter);
+                point.m_operationsPerSecond = benchmark.GetOperationsPerSecond();
+                points.push_back(point);
+
+                if (std::find(seriesOrder.begin(), seriesOrder.end(), point.m_series) == seriesOrder.end())
+                {
+                    seriesOrder.push_back(point.m_series);
+                }
+            }
+
+            std::sort(points.begin(), points.end(), [&seriesOrder](const Point& a, const Point& b)
+            {
+                if (a.m_series != b.m_series)
+                {
+                    return std::find(seriesOrder.begin(), seriesOrder.end(), a.m_series) < std::find(seriesOrder.begin(), seriesOrder.end(), b.m_series);
+                }
+
+                return a.m_numThreads < b.m_numThreads;
+            });
+
+            const Point* reference = nullptr;
+            for (auto& point : points)
+            {
+                if (!reference || reference->m_series != point.m_series)
+                {
+                    reference = &point;
+                }
+
+                if (reference->m_numThreads == 1)
+                {
+                    point.m_hasSpeedup = true;
+                    point.m_speedup = point.m_operationsPerSecond / reference->m_operationsPerSecond;
+                    point.m_efficiency = point.m_speedup / static_cast<double>(point.m_numThreads);
+                }
+            }
+
+            return points;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_THREADSCALING_H_
+#define _ICBENCHMARK_THREADSCALING_H_
+
+#include "BenchmarkReport.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace IC
+{
+    /// A container for functions which analyse how the throughput of a
+    /// parameterised benchmark scales with the number of threads it uses. The
+    /// thread count must be provided by a parameter with the name given by
+    /// k_threadsParameter.
+    ///
+    /// This is thread-safe.
+    ///
+    namespace ThreadScaling
+    {
+        /// The name of the parameter which describes the number of threads.
+        ///
+        constexpr char k_threadsParameter[] = "threads";
+
+        /// The scaling of a single instance of a benchmark.
+        ///
+        struct Point final
+        {
+            /// The name of the benchmark without its thread count, which is
+            /// shared by every point in the same series.
+            ///
+            std::string m_series;
+
+            /// The number of threads.
+            ///
+            std::uint64_t m_numThreads = 0;
+
+            /// The operations performed per second, across all threads.
+            ///
+            double m_operationsPerSecond = 0.0;
+
+            /// Whether or not the series has a single threaded point, without
+            /// which the speedup and efficiency are unknown and left at zero.
+            ///
+            bool m_hasSpeedup = false;
+
+            /// The throughput relative to the single threaded point of the
+            /// series.
+            ///
+            double m_speedup = 0.0;
+
+            /// The speedup divided by the number of threads, where 1.0 is
+            /// perfect linear scaling.
+            ///
+            double m_efficiency = 0.0;
+        };
+
+        /// Computes the scaling of every successful benchmark in the group which
+        /// has a thread count parameter and reports a number of operations.
+        /// Benchmarks which only differ in their thread count form a series,
+        /// and speedup is relative to the single threaded point of the series.
+        /// Series which start at more than one thread have no speedup, rather
+        /// than one which assumes how the lowest thread count scaled.
+        ///
+        /// @param benchmarkGroup
+        ///        The benchmark group to analyse.
+        ///
+        /// @return The points of each series, in order of first appearance in
+        /// the group and then in order of thread count.
+        ///
+        std::vector<Point> Analyse(const BenchmarkReport::BenchmarkGroup& benchmarkGroup) noexcept;
+    }
+}
+
+#endif
\ No newline at end of file
@@ -46,8 +46,10 @@ namespace IC
 
         if (reset == true)
         {
-            m_start = std::chrono::high_resolution_clock::now();
+            m_elapsedTime = 0;
         }
+
+        m_start = std::chrono::steady_clock::now();
     }
 
     //-----------------------------------------------------------------------------
@@ -55,14 +57,14 @@ namespace IC
     {
         assert(m_running);
 
-        std::chrono::milliseconds elapsedTimeMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - m_start);
-        m_elapsedTime = static_cast<std::uint32_t>(elapsedTimeMs.count());
+        std::chrono::nanoseconds elapsedTimeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start);
+        m_elapsedTime += static_cast<std::uint64_t>(elapsedTimeNs.count());
 
         m_running = false;
     }
 
     //-----------------------------------------------------------------------------
-    std::uint32_t Timer::GetElapsedTime() const noexcept
+    std::uint64_t Timer::GetElapsedTime() const noexcept
     {
         return m_elapsedTime;
     }
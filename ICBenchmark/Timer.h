@@ -30,10 +30,13 @@
 
 namespace IC
 {
-    /// A simple timer for tracking elapsed time in milliseconds. By default a
+    /// A simple timer for tracking elapsed time in nanoseconds. By default a
     /// timer starts running when it is created. This can be disabled by passing
     /// false to the constructor.
     ///
+    /// The timer is backed by the steady clock so that it can't be affected by
+    /// changes to the system time mid benchmark.
+    ///
     /// This is not thread-safe, and therefore each Timer instance should only be
     /// used on one thread at a time.
     ///
@@ -55,8 +58,10 @@ namespace IC
 
         /// Starts the timer running. This is only needed if re-starting the timer
         /// or false was passed during construction. By default the timer will be
-        /// reset when restarting, if resuming the timer is desired false can be
-        /// passed in. This will assert if the Timer is already running when called.
+        /// reset when restarting, discarding the elapsed time. If false is passed
+        /// in the timer resumes instead, and the time until the next call to
+        /// Stop() is added to the elapsed time. This will assert if the Timer is
+        /// already running when called.
         ///
         /// @param reset
         ///        Whether or not the timer should be reset. Defaults to true.
@@ -68,15 +73,16 @@ namespace IC
         ///
         void Stop() noexcept;
 
-        /// @return The elapsed time in milliseconds, recorded the last time stop()
-        /// was called.
+        /// @return The elapsed time in nanoseconds accumulated over every period
+        /// the timer has run for since it was last reset, up to the last time
+        /// Stop() was called.
         ///
-        std::uint32_t GetElapsedTime() const noexcept;
+        std::uint64_t GetElapsedTime() const noexcept;
 
     private:
         bool m_running = false;
-        std::chrono::high_resolution_clock::time_point m_start;
-        std::uint32_t m_elapsedTime = 0;
+        std::chrono::steady_clock::time_point m_start;
+        std::uint64_t m_elapsedTime = 0;
     };
 }
 
@@ -0,0 +1,107 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "WorkerPool.h"
+
+#include "CpuControl.h"
+#include "Timer.h"
+
+#include <cassert>
+
+namespace IC
+{
+    //------------------------------------------------------------------------------
+    WorkerPool::WorkerPool(std::uint32_t numThreads, const Work& work, const std::vector<std::uint32_t>& cpus) noexcept
+        : m_work(work), m_cpus(cpus), m_threadTimes(numThreads, 0), m_numReady(0), m_released(false), m_numRunning(numThreads)
+    {
+        assert(numThreads > 0);
+
+        for (std::uint32_t i = 0; i < numThreads; ++i)
+        {
+            m_threads.push_back(std::thread(&WorkerPool::RunWorker, this, i));
+        }
+
+        while (m_numReady.load(std::memory_order_acquire) < numThreads)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    void WorkerPool::Release() noexcept
+    {
+        assert(!m_released.load());
+
+        m_released.store(true, std::memory_order_release);
+    }
+
+    //------------------------------------------------------------------------------
+    void WorkerPool::WaitForCompletion() noexcept
+    {
+        assert(m_released.load());
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_completedCondition.wait(lock, [this]() { return m_numRunning == 0; });
+    }
+
+    //------------------------------------------------------------------------------
+    void WorkerPool::RunWorker(std::uint32_t threadIndex) noexcept
+    {
+        if (!m_cpus.empty())
+        {
+            CpuControl::SetThreadAffinity(m_cpus[threadIndex % m_cpus.size()]);
+        }
+
+        m_numReady.fetch_add(1, std::memory_order_acq_rel);
+
+        while (!m_released.load(std::memory_order_acquire))
+        {
+            std::this_thread::yield();
+        }
+
+        Timer timer;
+        m_work(threadIndex);
+        timer.Stop();
+
+        m_threadTimes[threadIndex] = timer.GetElapsedTime();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (--m_numRunning == 0)
+        {
+            m_completedCondition.notify_one();
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    WorkerPool::~WorkerPool() noexcept
+    {
+        if (!m_released.load())
+        {
+            Release();
+        }
+
+        for (auto& thread : m_threads)
+        {
+            thread.join();
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_WORKERPOOL_H_
+#define _ICBENCHMARK_WORKERPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace IC
+{
+    /// A pool of worker threads used to run a single piece of multi-threaded
+    /// benchmark work. All threads are spawned when the pool is created and
+    /// wait at a start barrier, so that thread creation is kept out of the
+    /// measurement. Release() then lets every worker begin at the same moment,
+    /// so they genuinely contend rather than starting staggered. Each worker
+    /// times its own work with a separate Timer.
+    ///
+    /// Workers spin, yielding, at the start barrier, so the pool should only
+    /// exist for as long as it takes to run the work.
+    ///
+    /// If a list of CPUs is given, each worker pins itself to one of them
+    /// before reaching the start barrier, assigned in turn.
+    ///
+    /// A pool can only be run once. It must be created and used from a single
+    /// thread, but the work is called concurrently from every worker.
+    ///
+    class WorkerPool final
+    {
+    public:
+        /// The work performed by each worker thread.
+        ///
+        /// @param threadIndex
+        ///        The index of the worker, in the range [0, numThreads).
+        ///
+        using Work = std::function<void(std::uint32_t threadIndex) noexcept>;
+
+        /// Spawns the given number of worker threads and waits until every one
+        /// has reached the start barrier.
+        ///
+        /// @param numThreads
+        ///        The number of worker threads. Must be greater than zero.
+        /// @param work
+        ///        The work each thread should perform once released.
+        /// @param cpus
+        ///        (Optional) The logical CPUs the workers should be pinned to.
+        ///        If empty the workers are not pinned.
+        ///
+        WorkerPool(std::uint32_t numThreads, const Work& work, const std::vector<std::uint32_t>& cpus = std::vector<std::uint32_t>()) noexcept;
+
+        /// Releases every worker simultaneously. This will assert if the pool
+        /// has already been released.
+        ///
+        void Release() noexcept;
+
+        /// Blocks until every worker has finished its work. This must be called
+        /// after Release().
+        ///
+        void WaitForCompletion() noexcept;
+
+        /// @return The time in nanoseconds each worker spent performing its
+        /// work, indexed by thread. This is only valid once the pool has
+        /// completed.
+        ///
+        const std::vector<std::uint64_t>& GetThreadTimes() const noexcept { return m_threadTimes; }
+
+        /// Waits for all worker threads to finish and joins them.
+        ///
+        ~WorkerPool() noexcept;
+
+    private:
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        /// The entry point of each worker thread.
+        ///
+        /// @param threadIndex
+        ///        The index of the worker.
+        ///
+        void RunWorker(std::uint32_t threadIndex) noexcept;
+
+        Work m_work;
+        std::vector<std::uint32_t> m_cpus;
+        std::vector<std::thread> m_threads;
+        std::vector<std::uint64_t> m_threadTimes;
+        std::atomic<std::uint32_t> m_numReady;
+        std::atomic<bool> m_released;
+
+        std::mutex m_mutex;
+        std::condition_variable m_completedCondition;
+        std::uint32_t m_numRunning;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,299 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "WorkloadGenerator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <queue>
+#include <random>
+
+namespace IC
+{
+    namespace
+    {
+        /// An allocation which is live while generating a workload.
+        ///
+        struct LiveAllocation final
+        {
+            std::uint64_t m_deathTime;
+            std::uint64_t m_sequence;
+            std::uint64_t m_size;
+            std::uint32_t m_slot;
+
+            /// Orders allocations so that the one which dies first is at the top
+            /// of a std::priority_queue, breaking ties by allocation order.
+            ///
+            bool operator<(const LiveAllocation& other) const noexcept
+            {
+                return m_deathTime != other.m_deathTime ? m_deathTime > other.m_deathTime : m_sequence > other.m_sequence;
+            }
+        };
+
+        /// @param random
+        ///        The random number generator.
+        ///
+        /// @return A value uniformly distributed in the open interval (0, 1).
+        ///
+        double SampleUniform(std::mt19937& random) noexcept
+        {
+            return (static_cast<double>(random()) + 0.5) / 4294967296.0;
+        }
+
+        /// @param random
+        ///        The random number generator.
+        /// @param min
+        ///        The smallest value.
+        /// @param max
+        ///        The largest value.
+        ///
+        /// @return An integer uniformly distributed in [min, max].
+        ///
+        std::uint64_t SampleUniform(std::mt19937& random, std::uint64_t min, std::uint64_t max) noexcept
+        {
+            auto value = min + static_cast<std::uint64_t>(SampleUniform(random) * static_cast<double>(max - min + 1));
+            return std::min(value, max);
+        }
+
+        /// Samples a bounded power-law distribution by inverting its CDF.
+        ///
+        /// @param random
+        ///        The random number generator.
+        /// @param min
+        ///        The smallest value. Must be greater than zero.
+        /// @param max
+        ///        The largest value.
+        /// @param exponent
+        ///        The exponent of the distribution.
+        ///
+        /// @return The sampled value.
+        ///
+        std::uint64_t SamplePowerLaw(std::mt19937& random, std::uint64_t min, std::uint64_t max, double exponent) noexcept
+        {
+            auto u = SampleUniform(random);
+            auto lower = static_cast<double>(min);
+            auto upper = static_cast<double>(max) + 1.0;
+
+            double value;
+            if (std::abs(exponent - 1.0) < 1e-9)
+            {
+                value = lower * std::pow(upper / lower, u);
+            }
+            else
+            {
+                auto power = 1.0 - exponent;
+                auto lowerPower = std::pow(lower, power);
+                value = std::pow(lowerPower + u * (std::pow(upper, power) - lowerPower), 1.0 / power);
+            }
+
+            return std::min(std::max(static_cast<std::uint64_t>(value), min), max);
+        }
+
+        /// Picks an index with probability proportional to its weight.
+        ///
+        /// @param random
+        ///        The random number generator.
+        /// @param weights
+        ///        Returns the weight of the given index.
+        /// @param count
+        ///        The number of indices.
+        /// @param totalWeight
+        ///        The sum of all weights.
+        ///
+        /// @return The picked index.
+        ///
+        template <typename TWeights> std::size_t SampleWeighted(std::mt19937& random, const TWeights& weights, std::size_t count, double totalWeight) noexcept
+        {
+            auto target = SampleUniform(random) * totalWeight;
+            for (std::size_t i = 0; i + 1 < count; ++i)
+            {
+                target -= weights(i);
+                if (target < 0.0)
+                {
+                    return i;
+                }
+            }
+
+            return count - 1;
+        }
+
+        /// @param random
+        ///        The random number generator.
+        /// @param component
+        ///        The component to sample the size distribution of.
+        ///
+        /// @return The sampled allocation size in bytes.
+        ///
+        std::uint64_t SampleSize(std::mt19937& random, const WorkloadComponent& component) noexcept
+        {
+            switch (component.m_sizeDistribution)
+            {
+            case SizeDistribution::k_uniform:
+                return SampleUniform(random, component.m_minSize, component.m_maxSize);
+            case SizeDistribution::k_powerLaw:
+                return SamplePowerLaw(random, std::max(component.m_minSize, static_cast<std::uint64_t>(1)), component.m_maxSize, component.m_powerLawExponent);
+            case SizeDistribution::k_histogram:
+            {
+                const auto& histogram = component.m_sizeHistogram;
+                assert(!histogram.empty());
+
+                double totalWeight = 0.0;
+                for (const auto& bucket : histogram)
+                {
+                    totalWeight += bucket.second;
+                }
+
+                auto index = SampleWeighted(random, [&](std::size_t i) { return histogram[i].second; }, histogram.size(), totalWeight);
+                auto min = index > 0 ? histogram[index - 1].first + 1 : 1;
+                return SampleUniform(random, min, std::max(min, histogram[index].first));
+            }
+            default:
+                assert(false);
+                return 0;
+            }
+        }
+
+        /// @param random
+        ///        The random number generator.
+        /// @param mean
+        ///        The mean of the distribution.
+        ///
+        /// @return A value drawn from an exponential distribution.
+        ///
+        double SampleExponential(std::mt19937& random, double mean) noexcept
+        {
+            return -mean * std::log(SampleUniform(random));
+        }
+
+        /// @param random
+        ///        The random number generator.
+        /// @param component
+        ///        The component to sample the lifetime distribution of.
+        ///
+        /// @return The sampled lifetime, in allocations. This is at least one.
+        ///
+        std::uint64_t SampleLifetime(std::mt19937& random, const WorkloadComponent& component) noexcept
+        {
+            double lifetime = 0.0;
+            switch (component.m_lifetimeDistribution)
+            {
+            case LifetimeDistribution::k_exponential:
+                lifetime = SampleExponential(random, component.m_meanLifetime);
+                break;
+            case LifetimeDistribution::k_bimodal:
+            {
+                auto longLived = SampleUniform(random) < component.m_longLivedFraction;
+                lifetime = SampleExponential(random, longLived ? component.m_longMeanLifetime : component.m_meanLifetime);
+                break;
+            }
+            default:
+                assert(false);
+                break;
+            }
+
+            return std::max(static_cast<std::uint64_t>(lifetime + 0.5), static_cast<std::uint64_t>(1));
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    WorkloadGenerator::WorkloadGenerator(const Workload& workload) noexcept
+    {
+        assert(!workload.m_components.empty());
+
+        std::mt19937 random(workload.m_seed);
+
+        double totalWeight = 0.0;
+        for (const auto& component : workload.m_components)
+        {
+            totalWeight += component.m_weight;
+        }
+
+        std::priority_queue<LiveAllocation> liveAllocations;
+        std::vector<std::uint32_t> freeSlots;
+        std::uint64_t liveBytes = 0;
+
+        m_records.reserve(static_cast<std::size_t>(workload.m_numAllocations * 2));
+
+        auto addRecord = [&](AllocationTraceEvent event, std::uint64_t time, std::uint32_t slot, std::uint64_t size)
+        {
+            AllocationTraceRecord record;
+            record.m_timestamp = time;
+            record.m_size = size;
+            record.m_slot = slot;
+            record.m_thread = 0;
+            record.m_alignmentLog2 = 0;
+            record.m_event = static_cast<std::uint8_t>(event);
+            m_records.push_back(record);
+        };
+
+        auto freeNext = [&](std::uint64_t time)
+        {
+            auto allocation = liveAllocations.top();
+            liveAllocations.pop();
+
+            addRecord(AllocationTraceEvent::k_deallocate, time, allocation.m_slot, 0);
+            freeSlots.push_back(allocation.m_slot);
+            liveBytes -= allocation.m_size;
+        };
+
+        for (std::uint64_t time = 0; time < workload.m_numAllocations; ++time)
+        {
+            while (!liveAllocations.empty() && liveAllocations.top().m_deathTime <= time)
+            {
+                freeNext(time);
+            }
+
+            auto componentIndex = SampleWeighted(random, [&](std::size_t i) { return workload.m_components[i].m_weight; }, workload.m_components.size(), totalWeight);
+            const auto& component = workload.m_components[componentIndex];
+            auto size = SampleSize(random, component);
+            auto lifetime = SampleLifetime(random, component);
+
+            while (!liveAllocations.empty() && liveBytes + size > workload.m_targetLiveBytes)
+            {
+                freeNext(time);
+            }
+
+            std::uint32_t slot;
+            if (!freeSlots.empty())
+            {
+                slot = freeSlots.back();
+                freeSlots.pop_back();
+            }
+            else
+            {
+                slot = static_cast<std::uint32_t>(m_numSlots++);
+            }
+
+            addRecord(AllocationTraceEvent::k_allocate, time, slot, size);
+            liveAllocations.push(LiveAllocation{time + lifetime, time, size, slot});
+            liveBytes += size;
+            m_peakLiveBytes = std::max(m_peakLiveBytes, liveBytes);
+            m_maxAllocationSize = std::max(m_maxAllocationSize, size);
+        }
+
+        while (!liveAllocations.empty())
+        {
+            freeNext(workload.m_numAllocations);
+        }
+    }
+}
\ No newline at end of file
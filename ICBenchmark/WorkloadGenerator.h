@@ -0,0 +1,184 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICBENCHMARK_WORKLOADGENERATOR_H_
+#define _ICBENCHMARK_WORKLOADGENERATOR_H_
+
+#include "AllocationTraceFormat.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace IC
+{
+    /// The distributions allocation sizes can be drawn from.
+    ///
+    enum class SizeDistribution
+    {
+        k_uniform,
+        k_powerLaw,
+        k_histogram
+    };
+
+    /// The distributions allocation lifetimes can be drawn from.
+    ///
+    enum class LifetimeDistribution
+    {
+        k_exponential,
+        k_bimodal
+    };
+
+    /// One class of allocation within a synthetic workload, for example small
+    /// short-lived objects, with its own size and lifetime distributions.
+    ///
+    /// Lifetimes are measured in allocations: an allocation with a lifetime of
+    /// ten is freed just before the tenth allocation after it is made.
+    ///
+    struct WorkloadComponent final
+    {
+        /// The relative probability that each allocation belongs to this
+        /// component.
+        ///
+        double m_weight = 1.0;
+
+        /// The distribution allocation sizes are drawn from.
+        ///
+        SizeDistribution m_sizeDistribution = SizeDistribution::k_uniform;
+
+        /// The smallest allocation size in bytes, for the uniform and power-law
+        /// distributions.
+        ///
+        std::uint64_t m_minSize = 8;
+
+        /// The largest allocation size in bytes, for the uniform and power-law
+        /// distributions.
+        ///
+        std::uint64_t m_maxSize = 256;
+
+        /// The exponent of the power-law distribution. Larger values make
+        /// small sizes more likely.
+        ///
+        double m_powerLawExponent = 2.0;
+
+        /// The buckets of the histogram distribution, for example as fitted to
+        /// a recorded trace. Each is the largest size in the bucket paired with
+        /// its relative weight, in increasing order of size. Sizes are uniform
+        /// within a bucket.
+        ///
+        std::vector<std::pair<std::uint64_t, double>> m_sizeHistogram;
+
+        /// The distribution allocation lifetimes are drawn from.
+        ///
+        LifetimeDistribution m_lifetimeDistribution = LifetimeDistribution::k_exponential;
+
+        /// The mean lifetime of the exponential distribution, and of the short
+        /// lived mode of the bimodal distribution.
+        ///
+        double m_meanLifetime = 100.0;
+
+        /// The mean lifetime of the long lived mode of the bimodal
+        /// distribution.
+        ///
+        double m_longMeanLifetime = 10000.0;
+
+        /// The probability that an allocation is long lived, for the bimodal
+        /// distribution.
+        ///
+        double m_longLivedFraction = 0.05;
+    };
+
+    /// Describes a synthetic workload.
+    ///
+    struct Workload final
+    {
+        /// The classes of allocation which make up the workload.
+        ///
+        std::vector<WorkloadComponent> m_components;
+
+        /// The total number of allocations.
+        ///
+        std::uint64_t m_numAllocations = 10000;
+
+        /// The largest number of bytes which may be live at once. If an
+        /// allocation would exceed it, the allocations closest to the end of
+        /// their lifetime are freed early to make room.
+        ///
+        std::uint64_t m_targetLiveBytes = 1024 * 1024;
+
+        /// The seed for the random number generator. The same workload and
+        /// seed always generate the same sequence on every platform.
+        ///
+        std::uint32_t m_seed = 1;
+    };
+
+    /// Generates the sequence of allocations and deallocations described by a
+    /// Workload, in the same form as a recorded AllocationTrace so that it can
+    /// be replayed in the same way. Every allocation is freed by the end of
+    /// the sequence, so it can be replayed repeatedly.
+    ///
+    /// Sampling is implemented directly on top of std::mt19937, rather than
+    /// with the standard distributions, as their output differs between
+    /// standard library implementations.
+    ///
+    /// This is thread-safe, as it is immutable after creation.
+    ///
+    class WorkloadGenerator final
+    {
+    public:
+        /// Generates the sequence for the given workload.
+        ///
+        /// @param workload
+        ///        The workload to generate. Must have at least one component.
+        ///
+        WorkloadGenerator(const Workload& workload) noexcept;
+
+        /// @return The generated records, in order.
+        ///
+        const AllocationTraceRecord* GetRecords() const noexcept { return m_records.data(); }
+
+        /// @return The number of generated records.
+        ///
+        std::uint64_t GetNumRecords() const noexcept { return m_records.size(); }
+
+        /// @return The number of slots used, which is the largest number of
+        /// allocations live at once.
+        ///
+        std::uint64_t GetNumSlots() const noexcept { return m_numSlots; }
+
+        /// @return The largest number of bytes live at once.
+        ///
+        std::uint64_t GetPeakLiveBytes() const noexcept { return m_peakLiveBytes; }
+
+        /// @return The size of the largest single allocation.
+        ///
+        std::uint64_t GetMaxAllocationSize() const noexcept { return m_maxAllocationSize; }
+
+    private:
+        std::vector<AllocationTraceRecord> m_records;
+        std::uint64_t m_numSlots = 0;
+        std::uint64_t m_peakLiveBytes = 0;
+        std::uint64_t m_maxAllocationSize = 0;
+    };
+}
+
+#endif
\ No newline at end of file
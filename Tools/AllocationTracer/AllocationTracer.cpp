@@ -0,0 +1,667 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2016 Ian Copland
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// An LD_PRELOAD shim which records every allocation and deallocation made by
+// a process into a compact binary trace, which can then be replayed against
+// each allocator by the AllocationTraceReplay benchmark group. This is Linux
+// only. To build and use it:
+//
+//     g++ -std=c++14 -O2 -shared -fPIC -o libICAllocationTracer.so Tools/AllocationTracer/AllocationTracer.cpp -ldl -pthread
+//     IC_ALLOCATION_TRACE=service.trace LD_PRELOAD=./libICAllocationTracer.so ./service
+//     IC_ALLOCATION_TRACE=service.trace ./ICMemoryBenchmark
+//
+// If IC_ALLOCATION_TRACE isn't set the trace is written to
+// allocations-<pid>.trace. Any "%p" in the path is replaced by the process id,
+// which is needed to keep the traces of child processes which inherit the
+// shim from overwriting each other.
+//
+// Every call is serialised through a single lock while it is recorded, so the
+// traced process will run more slowly, and the interleaving of threads in the
+// trace is the order in which they took the lock. The shim never allocates
+// through malloc itself: its bookkeeping is memory mapped directly.
+
+#include "../../ICBenchmark/AllocationTraceFormat.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace
+{
+    using MallocFunction = void* (*)(std::size_t);
+    using FreeFunction = void (*)(void*);
+    using CallocFunction = void* (*)(std::size_t, std::size_t);
+    using ReallocFunction = void* (*)(void*, std::size_t);
+    using MemalignFunction = void* (*)(std::size_t, std::size_t);
+    using PosixMemalignFunction = int (*)(void**, std::size_t, std::size_t);
+
+    constexpr std::size_t k_bootstrapBufferSize = 64 * 1024;
+    constexpr std::size_t k_bootstrapAlignment = 16;
+    constexpr std::size_t k_writeBufferSize = 64 * 1024;
+    constexpr std::size_t k_initialTableCapacity = 64 * 1024;
+    constexpr std::size_t k_initialFreeSlotCapacity = 16 * 1024;
+    constexpr std::uint32_t k_maxThreadIndex = 0xffff;
+    constexpr std::uint32_t k_emptySlot = 0xffffffff;
+
+    /// An entry in the table mapping the address of each live allocation to its
+    /// slot.
+    ///
+    struct SlotEntry final
+    {
+        std::uintptr_t m_address;
+        std::uint32_t m_slot;
+    };
+
+    MallocFunction g_realMalloc = nullptr;
+    FreeFunction g_realFree = nullptr;
+    CallocFunction g_realCalloc = nullptr;
+    ReallocFunction g_realRealloc = nullptr;
+    MemalignFunction g_realMemalign = nullptr;
+    MemalignFunction g_realAlignedAlloc = nullptr;
+    PosixMemalignFunction g_realPosixMemalign = nullptr;
+
+    alignas(k_bootstrapAlignment) std::uint8_t g_bootstrapBuffer[k_bootstrapBufferSize];
+    std::size_t g_bootstrapBufferUsed = 0;
+    bool g_resolving = false;
+
+    pthread_mutex_t g_mutex = PTHREAD_MUTEX_INITIALIZER;
+    bool g_tracing = false;
+    int g_file = -1;
+    timespec g_startTime;
+    std::uint64_t g_numRecords = 0;
+    std::uint32_t g_numThreads = 0;
+
+    IC::AllocationTraceRecord g_writeBuffer[k_writeBufferSize];
+    std::size_t g_writeBufferUsed = 0;
+
+    SlotEntry* g_table = nullptr;
+    std::size_t g_tableCapacity = 0;
+    std::size_t g_tableSize = 0;
+
+    std::uint32_t* g_freeSlots = nullptr;
+    std::size_t g_freeSlotCapacity = 0;
+    std::size_t g_numFreeSlots = 0;
+    std::uint32_t g_numSlots = 0;
+
+    __thread bool t_inTracer __attribute__((tls_model("initial-exec"))) = false;
+    __thread std::uint32_t t_threadIndex __attribute__((tls_model("initial-exec"))) = k_maxThreadIndex + 1;
+
+    /// Allocates memory directly from the operating system, bypassing malloc.
+    ///
+    /// @param size
+    ///        The size of the allocation in bytes.
+    ///
+    /// @return The zeroed allocation, or nullptr if it failed.
+    ///
+    void* MapMemory(std::size_t size) noexcept
+    {
+        auto memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        return memory != MAP_FAILED ? memory : nullptr;
+    }
+
+    /// Serves allocations made by dlsym() while the real allocation functions
+    /// are being looked up. These are never freed.
+    ///
+    /// @param size
+    ///        The size of the allocation in bytes.
+    ///
+    /// @return The zeroed allocation, or nullptr if the buffer is exhausted.
+    ///
+    void* BootstrapAllocate(std::size_t size) noexcept
+    {
+        auto alignedSize = (size + k_bootstrapAlignment - 1) & ~(k_bootstrapAlignment - 1);
+        if (alignedSize > k_bootstrapBufferSize - g_bootstrapBufferUsed)
+        {
+            return nullptr;
+        }
+
+        auto memory = g_bootstrapBuffer + g_bootstrapBufferUsed;
+        g_bootstrapBufferUsed += alignedSize;
+        return memory;
+    }
+
+    /// @param pointer
+    ///        The pointer to check.
+    ///
+    /// @return Whether or not the pointer was allocated by BootstrapAllocate().
+    ///
+    bool IsBootstrapAllocation(const void* pointer) noexcept
+    {
+        auto bytes = static_cast<const std::uint8_t*>(pointer);
+        return bytes >= g_bootstrapBuffer && bytes < g_bootstrapBuffer + k_bootstrapBufferSize;
+    }
+
+    /// Looks up the allocation functions which the shim forwards to, if that
+    /// hasn't already been done.
+    ///
+    void ResolveRealFunctions() noexcept
+    {
+        if (g_realMalloc || g_resolving)
+        {
+            return;
+        }
+
+        g_resolving = true;
+        g_realMalloc = reinterpret_cast<MallocFunction>(dlsym(RTLD_NEXT, "malloc"));
+        g_realFree = reinterpret_cast<FreeFunction>(dlsym(RTLD_NEXT, "free"));
+        g_realCalloc = reinterpret_cast<CallocFunction>(dlsym(RTLD_NEXT, "calloc"));
+        g_realRealloc = reinterpret_cast<ReallocFunction>(dlsym(RTLD_NEXT, "realloc"));
+        g_realMemalign = reinterpret_cast<MemalignFunction>(dlsym(RTLD_NEXT, "memalign"));
+        g_realAlignedAlloc = reinterpret_cast<MemalignFunction>(dlsym(RTLD_NEXT, "aligned_alloc"));
+        g_realPosixMemalign = reinterpret_cast<PosixMemalignFunction>(dlsym(RTLD_NEXT, "posix_memalign"));
+        g_resolving = false;
+    }
+
+    /// @param address
+    ///        The address to hash.
+    ///
+    /// @return The index in the slot table at which to start probing.
+    ///
+    std::size_t GetTableIndex(std::uintptr_t address) noexcept
+    {
+        auto hash = static_cast<std::uint64_t>(address >> 4) * 0x9e3779b97f4a7c15ull;
+        return static_cast<std::size_t>(hash >> 32) & (g_tableCapacity - 1);
+    }
+
+    /// Inserts an address into the slot table, which must have space for it.
+    ///
+    /// @param address
+    ///        The address of the allocation.
+    /// @param slot
+    ///        The slot of the allocation.
+    ///
+    void InsertEntry(std::uintptr_t address, std::uint32_t slot) noexcept
+    {
+        auto index = GetTableIndex(address);
+        while (g_table[index].m_slot != k_emptySlot)
+        {
+            index = (index + 1) & (g_tableCapacity - 1);
+        }
+
+        g_table[index].m_address = address;
+        g_table[index].m_slot = slot;
+        ++g_tableSize;
+    }
+
+    /// Doubles the capacity of the slot table, or creates it if it doesn't
+    /// exist yet.
+    ///
+    /// @return Whether or not the table could be grown.
+    ///
+    bool GrowTable() noexcept
+    {
+        auto oldTable = g_table;
+        auto oldCapacity = g_tableCapacity;
+
+        auto newCapacity = oldCapacity > 0 ? oldCapacity * 2 : k_initialTableCapacity;
+        auto newTable = static_cast<SlotEntry*>(MapMemory(newCapacity * sizeof(SlotEntry)));
+        if (!newTable)
+        {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < newCapacity; ++i)
+        {
+            newTable[i].m_slot = k_emptySlot;
+        }
+
+        g_table = newTable;
+        g_tableCapacity = newCapacity;
+        g_tableSize = 0;
+
+        for (std::size_t i = 0; i < oldCapacity; ++i)
+        {
+            if (oldTable[i].m_slot != k_emptySlot)
+            {
+                InsertEntry(oldTable[i].m_address, oldTable[i].m_slot);
+            }
+        }
+
+        if (oldTable)
+        {
+            munmap(oldTable, oldCapacity * sizeof(SlotEntry));
+        }
+
+        return true;
+    }
+
+    /// Removes an address from the slot table. The entries following it are
+    /// shifted back so that no tombstones are needed.
+    ///
+    /// @param address
+    ///        The address of the allocation.
+    /// @param out_slot
+    ///        (Out) The slot of the allocation.
+    ///
+    /// @return Whether or not the address was in the table.
+    ///
+    bool RemoveEntry(std::uintptr_t address, std::uint32_t& out_slot) noexcept
+    {
+        if (g_tableCapacity == 0)
+        {
+            return false;
+        }
+
+        auto mask = g_tableCapacity - 1;
+        auto index = GetTableIndex(address);
+        while (g_table[index].m_slot != k_emptySlot && g_table[index].m_address != address)
+        {
+            index = (index + 1) & mask;
+        }
+
+        if (g_table[index].m_slot == k_emptySlot)
+        {
+            return false;
+        }
+
+        out_slot = g_table[index].m_slot;
+        g_table[index].m_slot = k_emptySlot;
+        --g_tableSize;
+
+        auto next = (index + 1) & mask;
+        while (g_table[next].m_slot != k_emptySlot)
+        {
+            auto home = GetTableIndex(g_table[next].m_address);
+            if (((next - home) & mask) >= ((next - index) & mask))
+            {
+                g_table[index] = g_table[next];
+                g_table[next].m_slot = k_emptySlot;
+                index = next;
+            }
+
+            next = (next + 1) & mask;
+        }
+
+        return true;
+    }
+
+    /// Returns a slot to the free list so it can be reused.
+    ///
+    /// @param slot
+    ///        The slot which is no longer in use.
+    ///
+    void ReleaseSlot(std::uint32_t slot) noexcept
+    {
+        if (g_numFreeSlots == g_freeSlotCapacity)
+        {
+            auto newCapacity = g_freeSlotCapacity > 0 ? g_freeSlotCapacity * 2 : k_initialFreeSlotCapacity;
+            auto newFreeSlots = static_cast<std::uint32_t*>(MapMemory(newCapacity * sizeof(std::uint32_t)));
+            if (!newFreeSlots)
+            {
+                return;
+            }
+
+            if (g_freeSlots)
+            {
+                std::memcpy(newFreeSlots, g_freeSlots, g_numFreeSlots * sizeof(std::uint32_t));
+                munmap(g_freeSlots, g_freeSlotCapacity * sizeof(std::uint32_t));
+            }
+
+            g_freeSlots = newFreeSlots;
+            g_freeSlotCapacity = newCapacity;
+        }
+
+        g_freeSlots[g_numFreeSlots++] = slot;
+    }
+
+    /// @return A slot which isn't used by any live allocation.
+    ///
+    std::uint32_t AcquireSlot() noexcept
+    {
+        if (g_numFreeSlots > 0)
+        {
+            return g_freeSlots[--g_numFreeSlots];
+        }
+
+        return g_numSlots++;
+    }
+
+    /// Writes everything in the write buffer to the trace file.
+    ///
+    void FlushWriteBuffer() noexcept
+    {
+        auto bytes = reinterpret_cast<const std::uint8_t*>(g_writeBuffer);
+        auto remaining = g_writeBufferUsed * sizeof(IC::AllocationTraceRecord);
+        while (remaining > 0)
+        {
+            auto written = write(g_file, bytes, remaining);
+            if (written <= 0)
+            {
+                g_tracing = false;
+                break;
+            }
+
+            bytes += written;
+            remaining -= static_cast<std::size_t>(written);
+        }
+
+        g_writeBufferUsed = 0;
+    }
+
+    /// Appends a record to the trace. The lock must be held.
+    ///
+    /// @param event
+    ///        The event type.
+    /// @param slot
+    ///        The slot of the allocation.
+    /// @param size
+    ///        The requested size, or zero for deallocations.
+    /// @param alignment
+    ///        The requested alignment, or zero if none was requested.
+    ///
+    void AddRecord(IC::AllocationTraceEvent event, std::uint32_t slot, std::size_t size, std::size_t alignment) noexcept
+    {
+        if (t_threadIndex > k_maxThreadIndex)
+        {
+            t_threadIndex = g_numThreads < k_maxThreadIndex ? g_numThreads++ : k_maxThreadIndex;
+        }
+
+        timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+
+        std::uint8_t alignmentLog2 = 0;
+        while (alignment > 1)
+        {
+            alignment >>= 1;
+            ++alignmentLog2;
+        }
+
+        auto& record = g_writeBuffer[g_writeBufferUsed++];
+        record.m_timestamp = static_cast<std::uint64_t>(now.tv_sec - g_startTime.tv_sec) * 1000000000ull + static_cast<std::uint64_t>(now.tv_nsec) - static_cast<std::uint64_t>(g_startTime.tv_nsec);
+        record.m_size = size;
+        record.m_slot = slot;
+        record.m_thread = static_cast<std::uint16_t>(t_threadIndex);
+        record.m_alignmentLog2 = alignmentLog2;
+        record.m_event = static_cast<std::uint8_t>(event);
+        ++g_numRecords;
+
+        if (g_writeBufferUsed == k_writeBufferSize)
+        {
+            FlushWriteBuffer();
+        }
+    }
+
+    /// Records the given allocation and deallocation, either of which may be
+    /// absent. The deallocation is recorded first so that a reallocation in
+    /// place is handled correctly.
+    ///
+    /// @param allocation
+    ///        The new allocation, or nullptr.
+    /// @param size
+    ///        The requested size of the new allocation.
+    /// @param alignment
+    ///        The requested alignment of the new allocation, or zero.
+    /// @param deallocation
+    ///        The freed allocation, or nullptr.
+    ///
+    void Record(void* allocation, std::size_t size, std::size_t alignment, void* deallocation) noexcept
+    {
+        if (!g_tracing || t_inTracer || (!allocation && !deallocation))
+        {
+            return;
+        }
+
+        t_inTracer = true;
+        pthread_mutex_lock(&g_mutex);
+
+        if (g_tracing && deallocation)
+        {
+            std::uint32_t slot = 0;
+            if (RemoveEntry(reinterpret_cast<std::uintptr_t>(deallocation), slot))
+            {
+                AddRecord(IC::AllocationTraceEvent::k_deallocate, slot, 0, 0);
+                ReleaseSlot(slot);
+            }
+        }
+
+        if (g_tracing && allocation && ((g_tableSize + 1) * 2 <= g_tableCapacity || GrowTable()))
+        {
+            auto slot = AcquireSlot();
+            InsertEntry(reinterpret_cast<std::uintptr_t>(allocation), slot);
+            AddRecord(IC::AllocationTraceEvent::k_allocate, slot, size, alignment);
+        }
+
+        pthread_mutex_unlock(&g_mutex);
+        t_inTracer = false;
+    }
+
+    /// Writes the final counts into the header of the trace file.
+    ///
+    void WriteHeader() noexcept
+    {
+        IC::AllocationTraceHeader header;
+        header.m_recordSize = sizeof(IC::AllocationTraceRecord);
+        header.m_numThreads = g_numThreads;
+        header.m_numRecords = g_numRecords;
+        header.m_numSlots = g_numSlots;
+
+        if (pwrite(g_file, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header)))
+        {
+            g_tracing = false;
+        }
+    }
+
+    /// @return The path the trace should be written to, with any "%p" replaced
+    /// by the process id.
+    ///
+    std::string GetTracePath() noexcept
+    {
+        auto variable = std::getenv("IC_ALLOCATION_TRACE");
+        std::string path = variable && variable[0] != '\0' ? variable : "allocations-%p.trace";
+
+        auto pid = std::to_string(getpid());
+        for (auto position = path.find("%p"); position != std::string::npos; position = path.find("%p", position + pid.size()))
+        {
+            path.replace(position, 2, pid);
+        }
+
+        return path;
+    }
+
+    /// Stops tracing in a child process created with fork(), which would
+    /// otherwise interleave its records with the parent's.
+    ///
+    void OnForkChild() noexcept
+    {
+        g_tracing = false;
+        if (g_file >= 0)
+        {
+            close(g_file);
+            g_file = -1;
+        }
+
+        pthread_mutex_init(&g_mutex, nullptr);
+    }
+
+    /// Acquires the lock before fork() so that the child doesn't inherit it in
+    /// a locked state.
+    ///
+    void OnForkPrepare() noexcept
+    {
+        pthread_mutex_lock(&g_mutex);
+    }
+
+    /// Releases the lock in the parent once fork() has completed.
+    ///
+    void OnForkParent() noexcept
+    {
+        pthread_mutex_unlock(&g_mutex);
+    }
+
+    /// Opens the trace file and starts tracing. This runs when the shim is
+    /// loaded.
+    ///
+    __attribute__((constructor)) void StartTracing() noexcept
+    {
+        ResolveRealFunctions();
+
+        t_inTracer = true;
+        auto path = GetTracePath();
+        t_inTracer = false;
+
+        g_file = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (g_file < 0 || !GrowTable())
+        {
+            return;
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &g_startTime);
+        pthread_atfork(OnForkPrepare, OnForkParent, OnForkChild);
+
+        WriteHeader();
+        if (lseek(g_file, sizeof(IC::AllocationTraceHeader), SEEK_SET) < 0)
+        {
+            return;
+        }
+
+        g_tracing = true;
+    }
+
+    /// Flushes the remaining records and finalises the header. This runs when
+    /// the shim is unloaded, at process exit.
+    ///
+    __attribute__((destructor)) void StopTracing() noexcept
+    {
+        pthread_mutex_lock(&g_mutex);
+
+        if (g_tracing)
+        {
+            FlushWriteBuffer();
+            WriteHeader();
+            g_tracing = false;
+        }
+
+        if (g_file >= 0)
+        {
+            close(g_file);
+            g_file = -1;
+        }
+
+        pthread_mutex_unlock(&g_mutex);
+    }
+}
+
+extern "C"
+{
+    //------------------------------------------------------------------------------
+    void* malloc(std::size_t size) noexcept
+    {
+        ResolveRealFunctions();
+        if (!g_realMalloc)
+        {
+            return BootstrapAllocate(size);
+        }
+
+        auto pointer = g_realMalloc(size);
+        Record(pointer, size, 0, nullptr);
+        return pointer;
+    }
+
+    //------------------------------------------------------------------------------
+    void free(void* pointer) noexcept
+    {
+        if (!pointer || IsBootstrapAllocation(pointer))
+        {
+            return;
+        }
+
+        ResolveRealFunctions();
+        Record(nullptr, 0, 0, pointer);
+        g_realFree(pointer);
+    }
+
+    //------------------------------------------------------------------------------
+    void* calloc(std::size_t count, std::size_t size) noexcept
+    {
+        ResolveRealFunctions();
+        if (!g_realCalloc)
+        {
+            return size == 0 || count <= k_bootstrapBufferSize / size ? BootstrapAllocate(count * size) : nullptr;
+        }
+
+        auto pointer = g_realCalloc(count, size);
+        Record(pointer, count * size, 0, nullptr);
+        return pointer;
+    }
+
+    //------------------------------------------------------------------------------
+    void* realloc(void* pointer, std::size_t size) noexcept
+    {
+        ResolveRealFunctions();
+        if (pointer && IsBootstrapAllocation(pointer))
+        {
+            auto newPointer = malloc(size);
+            if (newPointer)
+            {
+                auto available = static_cast<std::size_t>(g_bootstrapBuffer + k_bootstrapBufferSize - static_cast<std::uint8_t*>(pointer));
+                std::memcpy(newPointer, pointer, size < available ? size : available);
+            }
+            return newPointer;
+        }
+
+        auto newPointer = g_realRealloc(pointer, size);
+        if (newPointer || size == 0)
+        {
+            Record(newPointer, size, 0, pointer);
+        }
+        return newPointer;
+    }
+
+    //------------------------------------------------------------------------------
+    void* memalign(std::size_t alignment, std::size_t size) noexcept
+    {
+        ResolveRealFunctions();
+        auto pointer = g_realMemalign(alignment, size);
+        Record(pointer, size, alignment, nullptr);
+        return pointer;
+    }
+
+    //------------------------------------------------------------------------------
+    void* aligned_alloc(std::size_t alignment, std::size_t size) noexcept
+    {
+        ResolveRealFunctions();
+        auto pointer = g_realAlignedAlloc(alignment, size);
+        Record(pointer, size, alignment, nullptr);
+        return pointer;
+    }
+
+    //------------------------------------------------------------------------------
+    int posix_memalign(void** out_pointer, std::size_t alignment, std::size_t size) noexcept
+    {
+        ResolveRealFunctions();
+        auto result = g_realPosixMemalign(out_pointer, alignment, size);
+        if (result == 0)
+        {
+            Record(*out_pointer, size, alignment, nullptr);
+        }
+        return result;
+    }
+}
\ No newline at end of file
@@ -24,7 +24,24 @@
 
 #include "ICBenchmark/ICBenchmark.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
+#include <string>
+
+/// Options describing where the report should be written and what it should
+/// be compared against.
+///
+struct ReportOptions final
+{
+    std::string m_jsonPath;
+    std::string m_csvPath;
+    std::string m_baselinePath;
+    double m_regressionThreshold = 0.05;
+};
 
 /// Prints a bar of the given lenth to standard out.
 ///
@@ -41,15 +58,379 @@ void PrintBar(std::size_t length) noexcept
     std::cout << std::endl;
 }
 
+/// Prints the given number of nanoseconds to standard out in milliseconds,
+/// with enough precision to distinguish short benchmarks.
+///
+/// @param timeNs
+///        The time in nanoseconds.
+///
+void PrintTimeMs(double timeNs) noexcept
+{
+    std::cout << std::fixed << std::setprecision(3) << timeNs / 1000000.0 << "ms";
+}
+
+/// Prints the share of the time each performance counter was enabled that it
+/// was actually running, if the kernel had to multiplex any of them, to
+/// standard out. Counters which were never scheduled are reported as such.
+///
+/// @param counters
+///        The performance counter values.
+///
+void PrintPerformanceCounterTimes(const IC::PerformanceCounterValues& counters) noexcept
+{
+    if (!counters.IsAnyMultiplexed())
+    {
+        return;
+    }
+
+    std::cout << "    counters running:";
+
+    auto first = true;
+    for (std::size_t i = 0; i < IC::PerformanceCounterValues::k_numCounters; ++i)
+    {
+        auto counter = static_cast<IC::PerformanceCounter>(i);
+        auto timeEnabled = counters.GetTimeEnabled(counter);
+        if (timeEnabled == 0)
+        {
+            continue;
+        }
+
+        std::cout << (first ? " " : ", ") << IC::PerformanceCounterValues::GetName(counter) << " ";
+        first = false;
+
+        auto timeRunning = counters.GetTimeRunning(counter);
+        if (timeRunning == 0)
+        {
+            std::cout << "never scheduled";
+        }
+        else
+        {
+            std::cout << std::fixed << std::setprecision(1) << 100.0 * static_cast<double>(timeRunning) / static_cast<double>(timeEnabled) << "%";
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+/// Prints the performance counters recorded for the given benchmark, if any,
+/// to standard out. Counters are reported per operation where possible.
+///
+/// @param benchmark
+///        The benchmark report.
+///
+void PrintPerformanceCounters(const IC::BenchmarkReport::Benchmark& benchmark) noexcept
+{
+    const auto& counters = benchmark.GetPerformanceCounters();
+    if (!counters.IsAnyAvailable())
+    {
+        PrintPerformanceCounterTimes(counters);
+        return;
+    }
+
+    std::cout << "    ";
+    if (counters.GetInstructionsPerCycle() > 0.0)
+    {
+        std::cout << "IPC " << std::fixed << std::setprecision(2) << counters.GetInstructionsPerCycle() << ", ";
+    }
+
+    std::cout << (benchmark.GetNumOperations() > 0 ? "per op:" : "total:");
+
+    for (std::size_t i = 0; i < IC::PerformanceCounterValues::k_numCounters; ++i)
+    {
+        auto counter = static_cast<IC::PerformanceCounter>(i);
+        if (!counters.IsAvailable(counter))
+        {
+            continue;
+        }
+
+        std::cout << " " << IC::PerformanceCounterValues::GetName(counter) << " ";
+        if (benchmark.GetNumOperations() > 0)
+        {
+            std::cout << std::fixed << std::setprecision(3) << benchmark.GetPerformanceCounterPerOperation(counter);
+        }
+        else
+        {
+            std::cout << counters.GetValue(counter);
+        }
+    }
+
+    std::cout << std::endl;
+
+    PrintPerformanceCounterTimes(counters);
+}
+
+/// Prints the operating system resources used by the given benchmark, if
+/// available, to standard out. Counts are averaged over the measured runs.
+///
+/// @param benchmark
+///        The benchmark report.
+///
+void PrintResourceUsage(const IC::BenchmarkReport::Benchmark& benchmark) noexcept
+{
+    const auto& usage = benchmark.GetResourceUsage();
+    auto numSamples = benchmark.GetStatistics().GetNumSamples();
+    if (!usage.m_available || numSamples == 0)
+    {
+        return;
+    }
+
+    auto numRuns = static_cast<double>(numSamples);
+
+    std::cout << "    per run: RSS peak +" << std::fixed << std::setprecision(1) << static_cast<double>(usage.m_peakResidentGrowth) / 1024.0 << "KB, retained "
+        << static_cast<double>(usage.m_retainedResidentGrowth) / numRuns / 1024.0 << "KB, faults " << static_cast<double>(usage.m_minorPageFaults) / numRuns << " minor "
+        << static_cast<double>(usage.m_majorPageFaults) / numRuns << " major, context switches " << static_cast<double>(usage.m_voluntaryContextSwitches) / numRuns
+        << " voluntary " << static_cast<double>(usage.m_involuntaryContextSwitches) / numRuns << " involuntary, CPU ";
+    PrintTimeMs(static_cast<double>(usage.m_userTime) / numRuns);
+    std::cout << " user ";
+    PrintTimeMs(static_cast<double>(usage.m_systemTime) / numRuns);
+    std::cout << " sys (" << std::setprecision(1) << usage.GetSystemTimeFraction() * 100.0 << "% sys)" << std::endl;
+}
+
+/// Prints the per-thread and aggregate times of the given benchmark, if it
+/// was multi-threaded, to standard out. Times are averaged over the measured
+/// runs.
+///
+/// @param benchmark
+///        The benchmark report.
+///
+void PrintThreadTimes(const IC::BenchmarkReport::Benchmark& benchmark) noexcept
+{
+    const auto& threadTimes = benchmark.GetThreadTimes();
+    if (threadTimes.empty())
+    {
+        return;
+    }
+
+    auto numRuns = static_cast<double>(benchmark.GetStatistics().GetNumSamples());
+    double fastest = static_cast<double>(threadTimes.front());
+    double slowest = fastest;
+    double total = 0.0;
+    for (auto threadTime : threadTimes)
+    {
+        fastest = std::min(fastest, static_cast<double>(threadTime));
+        slowest = std::max(slowest, static_cast<double>(threadTime));
+        total += static_cast<double>(threadTime);
+    }
+
+    std::cout << "    " << threadTimes.size() << " threads: fastest ";
+    PrintTimeMs(fastest / numRuns);
+    std::cout << ", slowest ";
+    PrintTimeMs(slowest / numRuns);
+    std::cout << ", aggregate ";
+    PrintTimeMs(total / numRuns);
+    std::cout << ", imbalance " << std::setprecision(1) << benchmark.GetThreadImbalance() * 100.0 << "%" << std::endl;
+}
+
+/// Prints the benchmark specific counters set by the given benchmark, if any,
+/// to standard out. Values are averaged over the measured runs.
+///
+/// @param benchmark
+///        The benchmark report.
+///
+void PrintCounters(const IC::BenchmarkReport::Benchmark& benchmark) noexcept
+{
+    auto counters = benchmark.GetCounters();
+    if (counters.empty())
+    {
+        return;
+    }
+
+    std::cout << "    counters:";
+    auto first = true;
+    for (const auto& counter : counters)
+    {
+        std::cout << (first ? " " : ", ") << counter.first << " " << std::fixed << std::setprecision(3) << counter.second;
+        first = false;
+    }
+
+    std::cout << std::endl;
+}
+
+/// Prints the snapshots recorded by the given soak benchmark, if any, to
+/// standard out, followed by the change in throughput between the first and
+/// last snapshot.
+///
+/// @param benchmark
+///        The benchmark report.
+///
+void PrintSnapshots(const IC::BenchmarkReport::Benchmark& benchmark) noexcept
+{
+    const auto& snapshots = benchmark.GetSnapshots();
+    if (snapshots.empty())
+    {
+        return;
+    }
+
+    for (const auto& snapshot : snapshots)
+    {
+        std::cout << "    at " << std::fixed << std::setprecision(0) << static_cast<double>(snapshot.m_time) / 1000000000.0 << "s: " << std::setprecision(2)
+            << snapshot.m_operationsPerSecond / 1000000.0 << "M ops/s, live " << std::setprecision(1) << static_cast<double>(snapshot.m_liveBytes) / 1024.0
+            << "KB, reserved " << static_cast<double>(snapshot.m_reservedBytes) / 1024.0 << "KB, largest allocation " << static_cast<double>(snapshot.m_largestAllocation) / 1024.0
+            << "KB, RSS " << static_cast<double>(snapshot.m_residentBytes) / 1024.0 << "KB" << std::endl;
+    }
+
+    auto firstThroughput = snapshots.front().m_operationsPerSecond;
+    if (snapshots.size() > 1 && firstThroughput > 0.0)
+    {
+        auto change = snapshots.back().m_operationsPerSecond / firstThroughput - 1.0;
+        std::cout << "    throughput change over soak " << std::showpos << std::setprecision(1) << change * 100.0 << "%" << std::noshowpos << std::endl;
+    }
+}
+
+/// Prints a summary of the given latency histogram to standard out, if it
+/// contains any values.
+///
+/// @param label
+///        The label describing the latencies.
+/// @param latencies
+///        The histogram, in CycleClock ticks.
+///
+void PrintLatencies(const std::string& label, const IC::LatencyHistogram& latencies) noexcept
+{
+    if (latencies.GetCount() == 0)
+    {
+        return;
+    }
+
+    const double k_percentiles[] = { 50.0, 90.0, 99.0, 99.9 };
+    const char* k_percentileNames[] = { "p50", "p90", "p99", "p99.9" };
+
+    std::cout << "    " << label << " latency:";
+    for (std::size_t i = 0; i < sizeof(k_percentiles) / sizeof(k_percentiles[0]); ++i)
+    {
+        std::cout << " " << k_percentileNames[i] << " " << std::fixed << std::setprecision(1) << IC::CycleClock::ToNanoseconds(latencies.GetPercentile(k_percentiles[i])) << "ns";
+    }
+
+    std::cout << " max " << IC::CycleClock::ToNanoseconds(latencies.GetMax()) << "ns" << std::endl;
+}
+
+/// Prints the thread scaling of any benchmarks in the given group which were
+/// run with a range of thread counts. Speedup and efficiency are only printed
+/// for series with a single threaded run to compare against.
+///
+/// @param benchmarkGroup
+///        The benchmark group report.
+///
+void PrintThreadScaling(const IC::BenchmarkReport::BenchmarkGroup& benchmarkGroup) noexcept
+{
+    auto points = IC::ThreadScaling::Analyse(benchmarkGroup);
+    if (points.empty())
+    {
+        return;
+    }
+
+    std::cout << std::endl;
+    std::cout << "Thread scaling:" << std::endl;
+
+    for (const auto& point : points)
+    {
+        std::cout << "    " << point.m_series << " x" << point.m_numThreads << ": " << std::fixed << std::setprecision(2) << point.m_operationsPerSecond / 1000000.0 << "M ops/s";
+        if (point.m_hasSpeedup)
+        {
+            std::cout << ", speedup " << point.m_speedup << ", efficiency " << std::setprecision(1) << point.m_efficiency * 100.0 << "%";
+        }
+        std::cout << std::endl;
+    }
+}
+
+/// Prints how much slower the cold cache variant of a benchmark was than the
+/// warm benchmark it was created from, if the given benchmark is one.
+///
+/// @param benchmarkGroup
+///        The group containing the benchmark.
+/// @param benchmark
+///        The benchmark which may be a cold cache variant.
+///
+void PrintColdComparison(const IC::BenchmarkReport::BenchmarkGroup& benchmarkGroup, const IC::BenchmarkReport::Benchmark& benchmark) noexcept
+{
+    const std::string k_coldSuffix = "/cold";
+
+    const auto& name = benchmark.GetName();
+    if (name.size() <= k_coldSuffix.size() || name.compare(name.size() - k_coldSuffix.size(), k_coldSuffix.size(), k_coldSuffix) != 0)
+    {
+        return;
+    }
+
+    auto warmName = name.substr(0, name.size() - k_coldSuffix.size());
+    for (const auto& warmBenchmark : benchmarkGroup.GetBenchmarks())
+    {
+        if (warmBenchmark.GetName() == warmName && !warmBenchmark.HasFailed() && warmBenchmark.GetTimePerIteration() > 0.0)
+        {
+            std::cout << "    cold " << std::fixed << std::setprecision(2) << benchmark.GetTimePerIteration() << "ns/iteration vs warm "
+                << warmBenchmark.GetTimePerIteration() << "ns/iteration, " << benchmark.GetTimePerIteration() / warmBenchmark.GetTimePerIteration() << "x" << std::endl;
+            return;
+        }
+    }
+}
+
+/// Prints a warning to standard out for each aspect of the processor state
+/// recorded in the given environment which is likely to make results less
+/// stable: CPU pinning or real-time priority that was requested but couldn't
+/// be applied, a frequency governor other than "performance", and enabled
+/// turbo boost.
+///
+/// @param environment
+///        The environment the benchmarks ran in.
+/// @param options
+///        The options the benchmarks were run with.
+///
+void PrintCpuWarnings(const IC::BenchmarkEnvironment& environment, const IC::BenchmarkOptions& options) noexcept
+{
+    auto hasWarnings = false;
+
+    if (!options.m_cpus.empty() && environment.m_cpuAffinity != std::to_string(options.m_cpus.front()))
+    {
+        std::cout << "Warning: Could not pin the main thread to CPU " << options.m_cpus.front() << "; benchmarks ran on CPUs " << environment.m_cpuAffinity << "." << std::endl;
+        hasWarnings = true;
+    }
+
+    if (options.m_realtimePriority && environment.m_schedulingPolicy != "SCHED_FIFO")
+    {
+        std::cout << "Warning: SCHED_FIFO is not permitted; benchmarks ran with " << environment.m_schedulingPolicy << "." << std::endl;
+        hasWarnings = true;
+    }
+
+    if (environment.m_frequencyGovernor != "unknown" && environment.m_frequencyGovernor != "performance")
+    {
+        std::cout << "Warning: The CPU frequency governor is '" << environment.m_frequencyGovernor << "' rather than 'performance', so clock speeds may vary." << std::endl;
+        hasWarnings = true;
+    }
+
+    if (environment.m_turboBoost == "enabled")
+    {
+        std::cout << "Warning: Turbo boost is enabled, so clock speeds may vary with temperature and load." << std::endl;
+        hasWarnings = true;
+    }
+
+    if (hasWarnings)
+    {
+        std::cout << std::endl;
+    }
+}
+
 /// Reports the results of the exectuted benchmarks to the output stream.
 ///
 /// @param report
 ///        A report detailing the results of the benchmark.
 ///
-void ReportResults(IC::BenchmarkReport& report) noexcept
+void ReportResults(const IC::BenchmarkReport& report) noexcept
 {
+    const auto& environment = report.GetEnvironment();
+
     std::cout << "Benchmark Results" << std::endl;
     std::cout << "=================" << std::endl;
+    std::cout << environment.m_cpuModel << " (" << environment.m_numCpus << " CPUs), " << environment.m_operatingSystem << std::endl;
+    std::cout << environment.m_compiler << ", " << environment.m_buildFlags << ", revision " << environment.m_gitRevision << std::endl;
+    std::cout << "CPUs " << environment.m_cpuAffinity << ", " << environment.m_schedulingPolicy << ", governor " << environment.m_frequencyGovernor << ", turbo "
+        << environment.m_turboBoost << std::endl;
+
+    const auto& overhead = report.GetHarnessOverhead();
+    if (overhead.m_available)
+    {
+        std::cout << "Harness overhead: timer " << std::fixed << std::setprecision(2) << overhead.m_timerOverhead << "ns, iteration " << overhead.m_iterationOverhead
+            << "ns, dispatch " << overhead.m_dispatchOverhead << "ns, noise floor " << overhead.m_noiseFloor << "ns/iteration"
+            << (overhead.m_subtracted ? " (subtracted)" : "") << std::endl;
+    }
     std::cout << std::endl;
 
     for (const auto& benchmarkGroup : report.GetBenchmarkGroups())
@@ -59,24 +440,509 @@ void ReportResults(IC::BenchmarkReport& report) noexcept
 
         for (const auto& benchmark : benchmarkGroup.GetBenchmarks())
         {
-            std::cout << benchmark.GetName() << ": " << benchmark.GetTimeTaken() << "ms" << std::endl;
+            if (benchmark.HasFailed())
+            {
+                std::cout << benchmark.GetName() << ": FAILED - " << benchmark.GetError() << std::endl;
+                continue;
+            }
+
+            const auto& statistics = benchmark.GetStatistics();
+
+            std::cout << benchmark.GetName() << ": ";
+            PrintTimeMs(statistics.GetMedian());
+            std::cout << " for " << benchmark.GetNumIterations() << " iterations (" << std::fixed << std::setprecision(2) << benchmark.GetTimePerIteration() << "ns/iteration";
+
+            if (benchmark.GetNumOperations() > 0)
+            {
+                std::cout << ", " << benchmark.GetTimePerOperation() << "ns/op";
+            }
+
+            std::cout << ")";
+
+            if (benchmark.GetNumOperations() > 0)
+            {
+                std::cout << ", " << benchmark.GetOperationsPerSecond() / 1000000.0 << "M ops/s";
+            }
+
+            if (benchmark.GetNumAllocatedBytes() > 0)
+            {
+                std::cout << ", " << benchmark.GetAllocatedBytesPerSecond() / 1000000000.0 << "GB/s allocated";
+            }
+
+            if (overhead.m_available && benchmark.GetTimePerIteration() < overhead.m_noiseFloor)
+            {
+                std::cout << " [below noise floor]";
+            }
+
+            std::cout << std::endl;
+
+            std::cout << "    min ";
+            PrintTimeMs(statistics.GetMin());
+            std::cout << ", mean ";
+            PrintTimeMs(statistics.GetMean());
+            std::cout << ", stddev ";
+            PrintTimeMs(statistics.GetStandardDeviation());
+            std::cout << ", 95% CI [";
+            PrintTimeMs(statistics.GetConfidenceIntervalMin());
+            std::cout << ", ";
+            PrintTimeMs(statistics.GetConfidenceIntervalMax());
+            std::cout << "], " << statistics.GetNumSamples() << " samples" << std::endl;
+
+            PrintColdComparison(benchmarkGroup, benchmark);
+            PrintPerformanceCounters(benchmark);
+            PrintResourceUsage(benchmark);
+            PrintThreadTimes(benchmark);
+            PrintCounters(benchmark);
+            PrintSnapshots(benchmark);
+            PrintLatencies("Allocation", benchmark.GetAllocationLatencies());
+            PrintLatencies("Deallocation", benchmark.GetDeallocationLatencies());
+        }
+
+        PrintThreadScaling(benchmarkGroup);
+
+        std::cout << std::endl;
+    }
+}
+
+/// Writes the given contents to a file, replacing any existing file.
+///
+/// @param path
+///        The path to the file.
+/// @param contents
+///        The contents to write.
+///
+/// @return Whether or not the file was written successfully.
+///
+bool WriteFile(const std::string& path, const std::string& contents) noexcept
+{
+    std::ofstream file(path, std::ios::binary);
+    file << contents;
+    return static_cast<bool>(file);
+}
+
+/// Reads the full contents of a file.
+///
+/// @param path
+///        The path to the file.
+/// @param out_contents
+///        (Out) The contents of the file.
+///
+/// @return Whether or not the file was read successfully.
+///
+bool ReadFile(const std::string& path, std::string& out_contents) noexcept
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    out_contents = contents.str();
+    return true;
+}
+
+/// Compares the given report against the baseline report at the given path,
+/// printing the change in each benchmark to standard out.
+///
+/// @param report
+///        The current report.
+/// @param reportOptions
+///        The report options, describing the baseline path and regression
+///        threshold.
+/// @param out_hasRegressions
+///        (Out) Whether or not any benchmark significantly regressed.
+///
+/// @return Whether or not the baseline could be loaded.
+///
+bool CompareWithBaseline(const IC::BenchmarkReport& report, const ReportOptions& reportOptions, bool& out_hasRegressions) noexcept
+{
+    std::string json;
+    IC::BenchmarkReport baseline(std::vector<IC::BenchmarkReport::BenchmarkGroup>{});
+    if (!ReadFile(reportOptions.m_baselinePath, json) || !IC::ReportSerialiser::FromJson(json, baseline))
+    {
+        std::cout << "Error: Could not load baseline report: " << reportOptions.m_baselinePath << std::endl;
+        return false;
+    }
+
+    std::string title = "Comparison with baseline (revision " + baseline.GetEnvironment().m_gitRevision + ", " + baseline.GetEnvironment().m_timestamp + ")";
+    std::cout << title << std::endl;
+    PrintBar(title.size());
+
+    out_hasRegressions = false;
+    for (const auto& delta : IC::ReportComparison::Compare(baseline, report, reportOptions.m_regressionThreshold))
+    {
+        std::cout << delta.m_groupName << "/" << delta.m_name << ": " << std::fixed << std::setprecision(2) << delta.m_baselineTime << "ns -> " << delta.m_currentTime
+            << "ns/iteration (" << std::showpos << delta.m_change * 100.0 << std::noshowpos << "%, p=" << std::setprecision(3) << delta.m_pValue << ")";
+
+        if (delta.m_isRegression)
+        {
+            std::cout << " REGRESSION";
+            out_hasRegressions = true;
+        }
+        else if (delta.m_isSignificant)
+        {
+            std::cout << (delta.m_change < 0.0 ? " improved" : " slower, within threshold");
         }
 
         std::cout << std::endl;
     }
+
+    std::cout << std::endl;
+    return true;
+}
+
+/// Prints the supported command line arguments to standard out.
+///
+void PrintUsage() noexcept
+{
+    std::cout << "Usage: ICMemoryBenchmark [options]" << std::endl;
+    std::cout << "  --warmup=N        The number of discarded warmup runs per benchmark." << std::endl;
+    std::cout << "  --repetitions=N   The number of measured runs per benchmark." << std::endl;
+    std::cout << "  --min-time=MS     The minimum duration of each run in milliseconds." << std::endl;
+    std::cout << "  --perf-counters   Record hardware performance counters where available." << std::endl;
+    std::cout << "  --latencies       Record the latency of each individual allocation and deallocation." << std::endl;
+    std::cout << "  --isolate=MODE    Run each 'benchmark' or each 'repetition' in a forked child process." << std::endl;
+    std::cout << "  --timeout=S       The time limit in seconds for each isolated child process." << std::endl;
+    std::cout << "  --json=PATH       Write the report to the given path as JSON." << std::endl;
+    std::cout << "  --csv=PATH        Write the report to the given path as CSV." << std::endl;
+    std::cout << "  --baseline=PATH   Compare against a previous JSON report, exiting with status 2 on regression." << std::endl;
+    std::cout << "  --threshold=PCT   The slowdown percentage above which a significant change is a regression." << std::endl;
+    std::cout << "  --cpus=LIST       Pin benchmark threads to the given CPUs, for example 2,3 or 4-7." << std::endl;
+    std::cout << "  --realtime        Request the SCHED_FIFO scheduling policy. Usually requires elevated privileges." << std::endl;
+    std::cout << "  --sequential      Run each benchmark to completion rather than interleaving repetitions within a group." << std::endl;
+    std::cout << "  --seed=N          The seed for the shuffled order of interleaved repetitions." << std::endl;
+    std::cout << "  --subtract-overhead  Subtract the measured timer and loop overhead from every sample." << std::endl;
+    std::cout << "  --cold-cache[=tlb]   Also run every benchmark with the caches, and optionally the TLB, evicted." << std::endl;
+    std::cout << "  --eviction-interval=N  The number of iterations between evictions in cold runs, or 0 for once per run." << std::endl;
+    std::cout << "  --soak=S          Run only the soak benchmarks, each for the given number of seconds." << std::endl;
+    std::cout << "  --snapshot-interval=S  The number of seconds between soak snapshots." << std::endl;
+    std::cout << std::endl;
+    std::cout << "Set IC_ALLOCATION_TRACE to the path of a trace recorded with Tools/AllocationTracer to also replay it against each allocator." << std::endl;
+}
+
+/// Parses the unsigned integer value of a command line argument in the form
+/// --name=value.
+///
+/// @param argument
+///        The full argument.
+/// @param prefix
+///        The argument name, including the leading dashes and trailing equals.
+/// @param out_value
+///        (Out) The parsed value. Only modified if parsing succeeds.
+///
+/// @return Whether or not the argument matched the prefix and was parsed.
+///
+bool ParseUnsignedArgument(const std::string& argument, const std::string& prefix, std::uint32_t& out_value) noexcept
+{
+    if (argument.compare(0, prefix.size(), prefix) != 0 || argument.size() == prefix.size())
+    {
+        return false;
+    }
+
+    char* end = nullptr;
+    auto value = std::strtoul(argument.c_str() + prefix.size(), &end, 10);
+    if (*end != '\0')
+    {
+        return false;
+    }
+
+    out_value = static_cast<std::uint32_t>(value);
+    return true;
 }
 
-/// The entry point to the application.
+/// Parses the string value of a command line argument in the form
+/// --name=value.
+///
+/// @param argument
+///        The full argument.
+/// @param prefix
+///        The argument name, including the leading dashes and trailing equals.
+/// @param out_value
+///        (Out) The value. Only modified if the argument matched.
+///
+/// @return Whether or not the argument matched the prefix and had a value.
 ///
-int main() noexcept
+bool ParseStringArgument(const std::string& argument, const std::string& prefix, std::string& out_value) noexcept
 {
-    auto report = IC::BenchmarkRunner::Run();
+    if (argument.compare(0, prefix.size(), prefix) != 0 || argument.size() == prefix.size())
+    {
+        return false;
+    }
+
+    out_value = argument.substr(prefix.size());
+    return true;
+}
 
+/// Parses a list of CPU indices in a command line argument in the form
+/// --name=list, where the list is comma separated and may contain ranges,
+/// for example --cpus=0,2-3.
+///
+/// @param argument
+///        The full argument.
+/// @param prefix
+///        The argument name, including the leading dashes and trailing equals.
+/// @param out_cpus
+///        (Out) The parsed CPU indices. Only modified if parsing succeeds.
+///
+/// @return Whether or not the argument matched the prefix and was parsed.
+///
+bool ParseCpuListArgument(const std::string& argument, const std::string& prefix, std::vector<std::uint32_t>& out_cpus) noexcept
+{
+    std::string list;
+    if (!ParseStringArgument(argument, prefix, list))
+    {
+        return false;
+    }
+
+    std::vector<std::uint32_t> cpus;
+    auto position = list.c_str();
+    while (true)
+    {
+        char* end = nullptr;
+        auto first = std::strtoul(position, &end, 10);
+        if (end == position)
+        {
+            return false;
+        }
+
+        auto last = first;
+        if (*end == '-')
+        {
+            position = end + 1;
+            last = std::strtoul(position, &end, 10);
+            if (end == position || last < first)
+            {
+                return false;
+            }
+        }
+
+        for (auto cpu = first; cpu <= last; ++cpu)
+        {
+            cpus.push_back(static_cast<std::uint32_t>(cpu));
+        }
+
+        if (*end == '\0')
+        {
+            break;
+        }
+
+        if (*end != ',')
+        {
+            return false;
+        }
+
+        position = end + 1;
+    }
+
+    out_cpus = cpus;
+    return true;
+}
+
+/// Parses the command line arguments into the benchmark and report options.
+///
+/// @param argc
+///        The number of arguments.
+/// @param argv
+///        The arguments, the first of which is the program name.
+/// @param out_options
+///        (Out) The benchmark options described by the arguments.
+/// @param out_reportOptions
+///        (Out) The report options described by the arguments.
+///
+/// @return Whether or not all arguments were valid.
+///
+bool ParseOptions(int argc, char* argv[], IC::BenchmarkOptions& out_options, ReportOptions& out_reportOptions) noexcept
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string argument = argv[i];
+
+        if (ParseUnsignedArgument(argument, "--warmup=", out_options.m_numWarmupRuns))
+        {
+            continue;
+        }
+
+        if (ParseUnsignedArgument(argument, "--repetitions=", out_options.m_numRepetitions) && out_options.m_numRepetitions > 0)
+        {
+            continue;
+        }
+
+        if (argument == "--perf-counters")
+        {
+            out_options.m_recordPerformanceCounters = true;
+            continue;
+        }
+
+        if (argument == "--latencies")
+        {
+            out_options.m_recordLatencies = true;
+            continue;
+        }
+
+        if (argument == "--isolate=benchmark")
+        {
+            out_options.m_isolation = IC::BenchmarkIsolation::k_perBenchmark;
+            continue;
+        }
+
+        if (argument == "--isolate=repetition")
+        {
+            out_options.m_isolation = IC::BenchmarkIsolation::k_perRepetition;
+            continue;
+        }
+
+        if (ParseUnsignedArgument(argument, "--timeout=", out_options.m_timeoutSeconds))
+        {
+            continue;
+        }
+
+        if (ParseStringArgument(argument, "--json=", out_reportOptions.m_jsonPath) || ParseStringArgument(argument, "--csv=", out_reportOptions.m_csvPath)
+            || ParseStringArgument(argument, "--baseline=", out_reportOptions.m_baselinePath))
+        {
+            continue;
+        }
+
+        if (ParseCpuListArgument(argument, "--cpus=", out_options.m_cpus))
+        {
+            continue;
+        }
+
+        if (argument == "--realtime")
+        {
+            out_options.m_realtimePriority = true;
+            continue;
+        }
+
+        if (argument == "--subtract-overhead")
+        {
+            out_options.m_subtractOverhead = true;
+            continue;
+        }
+
+        if (argument == "--sequential")
+        {
+            out_options.m_interleave = false;
+            continue;
+        }
+
+        if (ParseUnsignedArgument(argument, "--seed=", out_options.m_seed))
+        {
+            continue;
+        }
+
+        if (argument == "--cold-cache")
+        {
+            out_options.m_cacheEviction = IC::CacheEviction::k_caches;
+            continue;
+        }
+
+        if (argument == "--cold-cache=tlb")
+        {
+            out_options.m_cacheEviction = IC::CacheEviction::k_cachesAndTlb;
+            continue;
+        }
+
+        std::uint32_t evictionInterval = 0;
+        if (ParseUnsignedArgument(argument, "--eviction-interval=", evictionInterval))
+        {
+            out_options.m_evictionInterval = evictionInterval;
+            continue;
+        }
+
+        std::uint32_t soakSeconds = 0;
+        if (ParseUnsignedArgument(argument, "--soak=", soakSeconds) && soakSeconds > 0)
+        {
+            out_options.m_soakDuration = static_cast<std::uint64_t>(soakSeconds) * 1000000000;
+            continue;
+        }
+
+        std::uint32_t snapshotSeconds = 0;
+        if (ParseUnsignedArgument(argument, "--snapshot-interval=", snapshotSeconds) && snapshotSeconds > 0)
+        {
+            out_options.m_snapshotInterval = static_cast<std::uint64_t>(snapshotSeconds) * 1000000000;
+            continue;
+        }
+
+        std::uint32_t thresholdPercent = 0;
+        if (ParseUnsignedArgument(argument, "--threshold=", thresholdPercent))
+        {
+            out_reportOptions.m_regressionThreshold = static_cast<double>(thresholdPercent) / 100.0;
+            continue;
+        }
+
+        std::uint32_t minRunTimeMs = 0;
+        if (ParseUnsignedArgument(argument, "--min-time=", minRunTimeMs))
+        {
+            out_options.m_minRunTime = static_cast<std::uint64_t>(minRunTimeMs) * 1000000;
+            continue;
+        }
+
+        std::cout << "Invalid argument: " << argument << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+/// The entry point to the application. Exits with status 1 if the arguments
+/// are invalid or a file can't be read or written, and status 2 if any
+/// benchmark regressed relative to the baseline.
+///
+int main(int argc, char* argv[]) noexcept
+{
+    IC::BenchmarkOptions options;
+    ReportOptions reportOptions;
+    if (!ParseOptions(argc, argv, options, reportOptions))
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    if (options.m_recordPerformanceCounters && !IC::PerformanceCounters::IsSupported())
+    {
+        std::cout << "Warning: Hardware performance counters are unavailable on this system and will not be recorded." << std::endl;
+        std::cout << std::endl;
+        options.m_recordPerformanceCounters = false;
+    }
+
+    if (options.m_isolation != IC::BenchmarkIsolation::k_none && !IC::ProcessIsolation::IsSupported())
+    {
+        std::cout << "Warning: Process isolation is not supported on this platform; benchmarks will run in-process." << std::endl;
+        std::cout << std::endl;
+    }
+
+    auto report = IC::BenchmarkRunner::Run(options);
+
+    PrintCpuWarnings(report.GetEnvironment(), options);
     ReportResults(report);
 
-    //Wait for input before ending.
-    int x = 0;
-    std::cin >> x;
+    if (!reportOptions.m_jsonPath.empty() && !WriteFile(reportOptions.m_jsonPath, IC::ReportSerialiser::ToJson(report)))
+    {
+        std::cout << "Error: Could not write JSON report: " << reportOptions.m_jsonPath << std::endl;
+        return 1;
+    }
+
+    if (!reportOptions.m_csvPath.empty() && !WriteFile(reportOptions.m_csvPath, IC::ReportSerialiser::ToCsv(report)))
+    {
+        std::cout << "Error: Could not write CSV report: " << reportOptions.m_csvPath << std::endl;
+        return 1;
+    }
+
+    if (!reportOptions.m_baselinePath.empty())
+    {
+        auto hasRegressions = false;
+        if (!CompareWithBaseline(report, reportOptions, hasRegressions))
+        {
+            return 1;
+        }
+
+        if (hasRegressions)
+        {
+            return 2;
+        }
+    }
 
     return 0;
 }
\ No newline at end of file